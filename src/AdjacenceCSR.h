@@ -0,0 +1,110 @@
+/**
+ * \file      AdjacenceCSR.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe AdjacenceCSR.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe AdjacenceCSR permettant de représenter,
+ *             sous une forme compacte et non modifiable, les arcs d'un graphe orienté.
+ */
+
+#ifndef ADJACENCE_CSR_H
+#define ADJACENCE_CSR_H
+
+/**
+ *  \class AdjacenceCSR
+ *  \brief Une classe pour représenter les listes d'adjacence d'un graphe orienté au format CSR
+ *         (\e Compressed \e Sparse \e Row).
+ *  \details Les sommets du graphe sont numérotés de 0 à getNbreSommets() - 1. Les successeurs de tous
+ *           les sommets sont rangés les uns à la suite des autres dans un unique tableau : les successeurs
+ *           du sommet \c s occupent les cases \c debuts[s] à \c debuts[s+1] - 1 de ce tableau. \n
+ *           Les successeurs d'un sommet forment donc une tranche contiguë, obtenue en temps constant. \n
+ *           Une AdjacenceCSR n'est pas modifiable : elle est construite en une seule fois, à partir de la liste 
+ *           de tous les arcs du graphe, par deux tris par dénombrement successifs : selon la destination, puis, 
+ *           de façon stable, selon l'origine. Les successeurs de chaque sommet sont donc rangés par numéro 
+ *           croissant ; les arcs en double, devenus voisins, sont ensuite supprimés en un seul parcours. 
+ *           Deux tranches peuvent ainsi être comparées par fusion. \n
+ *           La construction coûte un temps en O(nombre de sommets + nombre d'arcs), soit une passe de 
+ *           dénombrement de plus qu'un tri selon la seule origine, et un tableau temporaire de nbreArcs cases.
+ */
+class AdjacenceCSR
+{
+public:
+/**
+ * \brief    Constructeur : construit les listes d'adjacence à partir de la liste des arcs d'un graphe.
+ * \param[in] nbreSommets  Le nombre de sommets du graphe.
+ * \param[in] nbreArcs  Le nombre d'arcs du graphe.
+ * \param[in] origines  Le tableau des sommets d'origine des arcs (nbreArcs cases).
+ * \param[in] destinations  Le tableau des sommets de destination des arcs (nbreArcs cases). \n
+ *           L'arc \c i relie le sommet \c origines[i] au sommet \c destinations[i]. Les arcs peuvent être
+ *           donnés dans n'importe quel ordre et en plusieurs exemplaires.
+ */
+    AdjacenceCSR (unsigned int nbreSommets, unsigned int nbreArcs,
+                  const unsigned int* origines, const unsigned int* destinations);
+
+
+    /**
+ * \brief    Construit les listes d'adjacence du graphe transposé (graphe dont tous les arcs sont inversés).
+ * \details  Un seul tri par dénombrement suffit : les sommets étant parcourus par numéro croissant,
+ *           les prédécesseurs de chaque sommet sont eux aussi rangés par numéro croissant et sans doublon.
+ * \return   Un objet AdjacenceCSR donnant, pour chaque sommet, la liste de ses prédécesseurs.
+ */
+    AdjacenceCSR* getTransposee ();
+
+
+    /**
+ * \brief    Indique le nombre de sommets du graphe.
+ * \return   Un entier positif ou nul correspondant au nombre de sommets.
+ */
+    unsigned int getNbreSommets ();
+
+    /**
+ * \brief    Indique le nombre d'arcs du graphe.
+ * \return   Un entier positif ou nul correspondant au nombre d'arcs distincts.
+ */
+    unsigned int getNbreArcs ();
+
+
+    /**
+ * \brief    Indique le nombre de successeurs d'un sommet.
+ * \param[in]  sommet  Le numéro du sommet.
+ * \return   Un entier positif ou nul correspondant au degré sortant du sommet.
+ */
+    unsigned int getDegre (unsigned int sommet);
+
+    /**
+ * \brief    Donne accès aux successeurs d'un sommet.
+ * \param[in]  sommet  Le numéro du sommet.
+ * \return   Un tableau contigu de getDegre(sommet) numéros de sommets distincts, par ordre croissant. \n
+ *           Ce tableau n'est pas une copie : il fait partie de la représentation CSR.
+ */
+    const unsigned int* getSuccesseurs (unsigned int sommet);
+
+
+private:
+    /**
+    \var unsigned int nbreSommets
+    \brief le nombre de sommets du graphe.
+*/
+    unsigned int nbreSommets;
+
+    /**
+    \var unsigned int nbreArcs
+    \brief le nombre d'arcs du graphe.
+*/
+    unsigned int nbreArcs;
+
+    /**
+    \var unsigned int* debuts
+    \brief pour chaque sommet, la position de son premier successeur dans le tableau successeurs
+           (nbreSommets + 1 cases, la dernière valant nbreArcs).
+*/
+    unsigned int* debuts;
+
+    /**
+    \var unsigned int* successeurs
+    \brief les successeurs de tous les sommets, rangés sommet par sommet et, pour un même sommet, 
+           par numéro croissant (nbreArcs cases).
+*/
+    unsigned int* successeurs;
+};
+#endif
@@ -0,0 +1,117 @@
+/**
+ * \file      AnalyseBranchesMortes.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe AnalyseBranchesMortes.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe AnalyseBranchesMortes permettant de repérer
+ *             les conditions toujours (ou jamais) vérifiées et les traitements qui ne sont jamais exécutés.
+ */
+
+#ifndef ANALYSE_BRANCHES_MORTES_H
+#define ANALYSE_BRANCHES_MORTES_H
+
+#include "Code.h"
+#include "EvaluateurExpressions.h"
+#include "ConditionSi.h"
+
+/**
+ *  \struct BrancheConstante
+ *  \brief Un enregistrement décrivant une ConditionSi dont l'expression a une valeur connue sans exécuter le code.
+ */
+struct BrancheConstante
+{
+    /**
+    \var StructureDeControle* structure
+    \brief la StructureSi ou StructureSiSinon contenant la condition.
+*/
+    StructureDeControle* structure;
+
+    /**
+    \var ConditionSi* condition
+    \brief la condition concernée.
+*/
+    ConditionSi* condition;
+
+    /**
+    \var ResultatEvaluation resultat
+    \brief EVALUATION_VRAI si la partie Si est toujours exécutée (la partie Sinon éventuelle ne l'est jamais),
+           EVALUATION_FAUX si la partie Si n'est jamais exécutée.
+*/
+    ResultatEvaluation resultat;
+};
+
+
+/**
+ *  \class AnalyseBranchesMortes
+ *  \brief Une classe pour repérer, dans un code, les branches des StructureSi et StructureSiSinon qui sont
+ *         toujours ou jamais exécutées, ainsi que les traitements morts.
+ *  \details L'expression de chaque ConditionSi est évaluée à l'aide de l'évaluateur du code
+ *           (voir Code::getEvaluateurExpressions()), partagé par toutes les analyses du code. \n
+ *           Un traitement est mort lorsque toutes les branches qui le déclenchent ne sont jamais exécutées,
+ *           ou lorsqu'il est contenu dans un traitement mort. L'arbre aplati des structures de contrôle 
+ *           (voir ArbreStructures) est parcouru une seule fois : lorsqu'une branche n'est jamais exécutée, 
+ *           ses descendants sont ignorés (voir ArbreStructures::sauterSousArbre()). L'analyse est donc 
+ *           linéaire en la taille du code.
+ */
+class AnalyseBranchesMortes
+{
+public:
+/**
+ * \brief    Constructeur : analyse les branches d'un code.
+ * \param[in] code  Le code (figé) à analyser.
+ */
+    AnalyseBranchesMortes (Code* code);
+
+
+    /**
+ * \brief    Indique le nombre de branches dont la condition a une valeur connue.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned int getNbreBranchesConstantes ();
+
+    /**
+ * \brief    Donne accès aux branches dont la condition a une valeur connue.
+ * \return   Un tableau de getNbreBranchesConstantes() enregistrements, rangés dans l'ordre d'apparition des structures.
+ */
+    BrancheConstante* getBranchesConstantes ();
+
+
+    /**
+ * \brief    Indique le nombre de traitements qui ne sont jamais exécutés.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned int getNbreTraitementsMorts ();
+
+    /**
+ * \brief    Identifie les traitements qui ne sont jamais exécutés.
+ * \return   Un tableau d'objets Traitement, éventuellement vide.
+ */
+    Traitement* getTraitementsMorts ();
+
+
+private:
+    /**
+    \var unsigned int nbreBranchesConstantes
+    \brief le nombre de branches dont la condition a une valeur connue.
+*/
+    unsigned int nbreBranchesConstantes;
+
+    /**
+    \var BrancheConstante* branchesConstantes
+    \brief les branches dont la condition a une valeur connue.
+*/
+    BrancheConstante* branchesConstantes;
+
+    /**
+    \var unsigned int nbreTraitementsMorts
+    \brief le nombre de traitements qui ne sont jamais exécutés.
+*/
+    unsigned int nbreTraitementsMorts;
+
+    /**
+    \var Traitement* traitementsMorts
+    \brief les traitements qui ne sont jamais exécutés.
+*/
+    Traitement* traitementsMorts;
+};
+#endif
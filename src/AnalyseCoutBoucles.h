@@ -0,0 +1,180 @@
+/**
+ * \file      AnalyseCoutBoucles.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe AnalyseCoutBoucles.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe AnalyseCoutBoucles permettant d'estimer
+ *             le nombre d'itérations de chaque boucle d'un code, et d'en déduire la complexité de chaque traitement.
+ */
+
+#ifndef ANALYSE_COUT_BOUCLES_H
+#define ANALYSE_COUT_BOUCLES_H
+
+#include "Code.h"
+#include "StructureIterative.h"
+
+/**
+ *  \enum ClasseNbreIterations
+ *  \brief Les classes de nombre d'itérations d'une boucle.
+ */
+enum ClasseNbreIterations
+{
+    ITERATIONS_CONSTANTES,      /**< le nombre d'itérations est une constante (bornes et pas constants) */
+    ITERATIONS_LINEAIRES,       /**< le nombre d'itérations est proportionnel à la valeur d'une Information ou à la taille d'une VariableStructuree (pas additif) */
+    ITERATIONS_LOGARITHMIQUES,  /**< le nombre d'itérations est proportionnel au logarithme de la valeur d'une Information (pas multiplicatif) */
+    ITERATIONS_INCONNUES        /**< le nombre d'itérations ne peut pas être estimé (itération avec nombre de répétitions inconnu, borne non affine...) */
+};
+
+
+/**
+ *  \struct EstimationBoucle
+ *  \brief Un enregistrement décrivant le nombre d'itérations estimé d'une boucle.
+ */
+struct EstimationBoucle
+{
+    /**
+    \var StructureIterative* boucle
+    \brief la boucle concernée.
+*/
+    StructureIterative* boucle;
+
+    /**
+    \var ClasseNbreIterations classe
+    \brief la classe du nombre d'itérations de la boucle.
+*/
+    ClasseNbreIterations classe;
+
+    /**
+    \var Information* grandeur
+    \brief pour ITERATIONS_LINEAIRES et ITERATIONS_LOGARITHMIQUES, l'information (ou la collection) dont dépend 
+           le nombre d'itérations ; \c null sinon.
+*/
+    Information* grandeur;
+
+    /**
+    \var unsigned long int nbreIterations
+    \brief pour ITERATIONS_CONSTANTES, le nombre d'itérations ; 0 sinon.
+*/
+    unsigned long int nbreIterations;
+};
+
+
+/**
+ *  \struct ComplexiteTraitement
+ *  \brief Un enregistrement décrivant la complexité estimée d'un traitement, de la forme O(n^degre . log^degreLogarithmique n).
+ */
+struct ComplexiteTraitement
+{
+    /**
+    \var Traitement* traitement
+    \brief le traitement concerné.
+*/
+    Traitement* traitement;
+
+    /**
+    \var unsigned short int degre
+    \brief le plus grand nombre de boucles ITERATIONS_LINEAIRES imbriquées les unes dans les autres 
+           (0 pour O(1), 1 pour O(n), 2 pour O(n^2)...).
+*/
+    unsigned short int degre;
+
+    /**
+    \var unsigned short int degreLogarithmique
+    \brief parmi les chemins comptant degre boucles ITERATIONS_LINEAIRES, le plus grand nombre de boucles 
+           ITERATIONS_LOGARITHMIQUES imbriquées (0 pour aucun facteur logarithmique, 1 pour log n...).
+*/
+    unsigned short int degreLogarithmique;
+
+    /**
+    \var bool contientBoucleInconnue
+    \brief indique si le traitement contient au moins une boucle ITERATIONS_INCONNUES, dont le coût n'est pas pris en compte dans degre.
+*/
+    bool contientBoucleInconnue;
+};
+
+
+/**
+ *  \class AnalyseCoutBoucles
+ *  \brief Une classe pour estimer le coût des boucles d'un code.
+ *  \details Le nombre d'itérations d'une IterationAvecNombreDeRepetitionsConnu est déduit de ses bornes et de son pas :
+ *           - bornes et pas formés uniquement de Constante et de NombreMagique : ITERATIONS_CONSTANTES ;
+ *           - une borne constante, l'autre affine en une seule Information (ou en la taille d'une VariableStructuree),
+ *             et pas additif constant : ITERATIONS_LINEAIRES ;
+ *           - mêmes bornes et pas multiplicatif constant strictement supérieur à 1 (voir 
+ *             IterationAvecNombreDeRepetitionsConnu::getPasMultiplicatif) : ITERATIONS_LOGARITHMIQUES ;
+ *           - autres cas : ITERATIONS_INCONNUES.
+ *
+ *           Une borne est affine en une Information \c n si son expression est de la forme <tt>a * n + b</tt>, 
+ *           \c a et \c b étant formés uniquement de Constante et de NombreMagique : elle ne contient qu'une seule 
+ *           feuille OPERATEUR_INFORMATION non constante, qui n'apparaît jamais sous une OPERATEUR_MULTIPLICATION 
+ *           ou une OPERATEUR_DIVISION dont l'autre opérande est lui aussi non constant, ni sous une OPERATEUR_MODULO 
+ *           ou une OPERATEUR_APPEL. Ainsi <tt>i < n * n</tt> ou <tt>i < n / m</tt> sont classées ITERATIONS_INCONNUES.
+ *
+ *           Une IterationAvecNombreDeRepetitionsInconnu est toujours classée ITERATIONS_INCONNUES. \n
+ *           Le degré de complexité de chaque traitement est ensuite obtenu en un seul parcours de l'arbre aplati
+ *           des structures de contrôle (voir ArbreStructures), en comptant séparément les boucles ITERATIONS_LINEAIRES
+ *           et ITERATIONS_LOGARITHMIQUES présentes sur le chemin de la racine à chaque nœud.
+ */
+class AnalyseCoutBoucles
+{
+public:
+/**
+ * \brief    Constructeur : estime le coût des boucles d'un code.
+ * \param[in] code  Le code (figé) à analyser.
+ */
+    AnalyseCoutBoucles (Code* code);
+
+
+    /**
+ * \brief    Indique le nombre de boucles du code.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned int getNbreBoucles ();
+
+    /**
+ * \brief    Donne accès aux estimations du nombre d'itérations de chaque boucle.
+ * \return   Un tableau de getNbreBoucles() enregistrements, rangés dans l'ordre d'apparition des boucles dans le code.
+ */
+    EstimationBoucle* getEstimationsBoucles ();
+
+
+    /**
+ * \brief    Donne accès à la complexité estimée de chaque traitement.
+ * \return   Un tableau d'enregistrements rangés selon le numéro des traitements (voir Traitement::getNumero()).
+ */
+    ComplexiteTraitement* getComplexitesTraitements ();
+
+    /**
+ * \brief    Identifie les traitements dont le degré de complexité atteint un seuil.
+ * \param[in]  degreMinimum  Le degré à partir duquel un traitement est signalé (2 pour O(n^2)).
+ * \return   Un tableau des traitements concernés, éventuellement vide.
+ */
+    Traitement* getTraitementsCouteux (unsigned short int degreMinimum = 2);
+
+
+private:
+    /**
+    \var Code* code
+    \brief le code analysé.
+*/
+    Code* code;
+
+    /**
+    \var unsigned int nbreBoucles
+    \brief le nombre de boucles du code.
+*/
+    unsigned int nbreBoucles;
+
+    /**
+    \var EstimationBoucle* estimationsBoucles
+    \brief les estimations du nombre d'itérations de chaque boucle.
+*/
+    EstimationBoucle* estimationsBoucles;
+
+    /**
+    \var ComplexiteTraitement* complexitesTraitements
+    \brief la complexité estimée de chaque traitement.
+*/
+    ComplexiteTraitement* complexitesTraitements;
+};
+#endif
@@ -0,0 +1,281 @@
+/**
+ * \file      AnalyseDefinitions.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe AnalyseDefinitions.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe AnalyseDefinitions permettant de savoir,
+ *             pour chaque information lue par un traitement, quels traitements ont pu en écrire la valeur.
+ */
+
+#ifndef ANALYSE_DEFINITIONS_H
+#define ANALYSE_DEFINITIONS_H
+
+#include "Code.h"
+#include "AdjacenceCSR.h"
+
+/**
+ *  \struct Definition
+ *  \brief Un enregistrement décrivant l'écriture d'une information par un traitement.
+ */
+struct Definition
+{
+    /**
+    \var unsigned int traitement
+    \brief le numéro du traitement qui écrit l'information, ou la valeur DEFINITION_INITIALE 
+           pour la définition fictive représentant la valeur d'une information avant toute écriture.
+*/
+    unsigned int traitement;
+
+    /**
+    \var unsigned int information
+    \brief le numéro de l'information écrite.
+*/
+    unsigned int information;
+
+    /**
+    \var bool estCertaine
+    \brief indique si l'écriture a lieu à chaque exécution du traitement (voir Code::estEcritureCertaine()). \n
+           Une écriture située dans une structure conditionnelle ou itérative du traitement (voir ArbreStructures)
+           n'est pas certaine : elle ne remplace pas les définitions précédentes de l'information.
+*/
+    bool estCertaine;
+};
+
+/**
+ * \brief    Valeur de Definition::traitement pour la définition fictive d'une information non initialisée
+ *           à sa déclaration.
+ */
+const unsigned int DEFINITION_INITIALE = 0xFFFFFFFF;
+
+
+/**
+ *  \struct LectureNonInitialisee
+ *  \brief Un enregistrement décrivant la lecture d'une information qui peut ne pas avoir été initialisée.
+ */
+struct LectureNonInitialisee
+{
+    /**
+    \var Traitement* traitement
+    \brief le traitement qui lit l'information.
+*/
+    Traitement* traitement;
+
+    /**
+    \var Information* information
+    \brief l'information lue.
+*/
+    Information* information;
+
+    /**
+    \var bool estCertaine
+    \brief \c true si aucune écriture de l'information n'atteint la lecture (l'information n'est jamais 
+           initialisée), \c false si seules certaines exécutions lisent une information non initialisée.
+*/
+    bool estCertaine;
+};
+
+
+/**
+ *  \class AnalyseDefinitions
+ *  \brief Une classe pour calculer les définitions atteignant chaque traitement d'un code et les chaînes 
+ *         définition - utilisation qui en découlent.
+ *  \details Seuls les traitements simples, feuilles de l'arbre des traitements (voir ArbreTraitements), 
+ *           portent des définitions et des lectures : les accès d'un traitement composé sont ceux de ses 
+ *           sous-traitements, et ne sont donc pas comptés une seconde fois. \n
+ *           Une définition est un arc traitement - résultat du graphe des accès du code (voir Code::getGrapheAcces()),
+ *           c'est-à-dire une écriture relevée lors de la décomposition du traitement, et non un résultat déclaré 
+ *           par son contrat. Elle est certaine si l'une au moins des positions auxquelles le traitement écrit 
+ *           l'information n'est contenue dans aucune structure conditionnelle ou itérative de l'ArbreStructures 
+ *           du code située dans ce traitement (voir Code::estEcritureCertaine()). \n
+ *           Les définitions sont numérotées information par information, dans l'ordre de 
+ *           GrapheFluxDeDonnees::getProducteurs() : les définitions d'une même information occupent des 
+ *           positions contiguës, précédées de sa définition fictive DEFINITION_INITIALE. Cette définition fictive
+ *           est absente pour une Constante et pour toute information initialisée à sa déclaration 
+ *           ( \c VAL_ARRET_SAISIE dans mainProf.cpp) : leur lecture n'est jamais signalée. \n
+ *           Le graphe de flot entre feuilles est déduit des liens Traitement::sontApres (voir ArbreTraitements) :
+ *           un lien d'un traitement \c A vers un traitement \c B relie la dernière feuille de \c A à la première 
+ *           feuille de \c B (un traitement simple est sa propre première et dernière feuille). Il est converti 
+ *           en AdjacenceCSR. \n
+ *           Chaque feuille est associée à trois ensembles de bits, d'une case par définition : les définitions
+ *           qu'elle produit, celles qu'elle supprime (les autres définitions des informations qu'elle écrit de 
+ *           façon certaine, c'est-à-dire une plage de bits) et celles qui l'atteignent. Ces ensembles sont calculés
+ *           par passes successives sur les feuilles rangées en ordre postfixe inverse du graphe de flot (calculé
+ *           une seule fois par un parcours en profondeur depuis la première feuille du code) : au sein d'une 
+ *           passe, chaque feuille utilise les ensembles déjà mis à jour par ses prédécesseurs. Les calculs 
+ *           s'arrêtent après la première passe qui ne modifie aucun ensemble. \n
+ *           Les fonctions de transfert n'opérant que bit à bit, les mots de 64 bits des ensembles sont 
+ *           indépendants les uns des autres : ils sont répartis en tranches entre les fils d'exécution, 
+ *           chaque fil réalisant les passes sur sa tranche. \n
+ *           Le coût d'une passe est linéaire en (nombre de feuilles + nombre de liens) × nombre de mots 
+ *           de 64 bits par ensemble ; dans l'ordre postfixe inverse, le nombre de passes est borné par 
+ *           le plus grand nombre d'arcs de retour sur un chemin sans cycle du graphe de flot + 2.
+ */
+class AnalyseDefinitions
+{
+public:
+/**
+ * \brief    Constructeur : calcule les définitions atteignant chaque traitement d'un code.
+ * \param[in] code  Le code (figé) à analyser.
+ * \param[in] nbreFilsExecution  Le nombre de fils d'exécution entre lesquels les mots des ensembles sont répartis. \n
+ *           La valeur 0 correspond au nombre de cœurs disponibles sur la machine.
+ */
+    AnalyseDefinitions (Code* code, unsigned short int nbreFilsExecution = 0);
+
+
+    /**
+ * \brief    Indique le nombre de définitions du code, définitions fictives comprises.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned int getNbreDefinitions ();
+
+    /**
+ * \brief    Donne accès aux définitions du code.
+ * \return   Un tableau de getNbreDefinitions() enregistrements, rangés information par information.
+ */
+    const Definition* getDefinitions ();
+
+
+    /**
+ * \brief    Indique combien de traitements ont pu écrire la valeur d'une information lue par un traitement.
+ * \param[in]  traitement  Le traitement simple qui lit l'information.
+ * \param[in]  information  L'information lue.
+ * \return   Un entier positif ou nul, sans compter la définition fictive DEFINITION_INITIALE.
+ */
+    unsigned int getNbreDefinitionsAtteignant (Traitement* traitement, Information* information);
+
+    /**
+ * \brief    Identifie les traitements qui ont pu écrire en dernier la valeur d'une information lue par un traitement.
+ * \details  Le résultat est obtenu en parcourant la plage de bits des définitions de l'information dans 
+ *           l'ensemble des définitions atteignant le traitement.
+ * \param[in]  traitement  Le traitement qui lit l'information.
+ * \param[in]  information  L'information lue.
+ * \return   Un tableau d'objets Traitement, éventuellement vide, rangés selon leur numéro.
+ */
+    Traitement* getDefinitionsAtteignant (Traitement* traitement, Information* information);
+
+
+    /**
+ * \brief    Indique combien de traitements lisent la valeur d'une information écrite par un traitement.
+ * \param[in]  traitement  Le traitement qui écrit l'information.
+ * \param[in]  information  L'information écrite.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned int getNbreUtilisations (Traitement* traitement, Information* information);
+
+    /**
+ * \brief    Identifie les traitements qui lisent la valeur d'une information écrite par un traitement
+ *           (chaîne définition - utilisation).
+ * \param[in]  traitement  Le traitement qui écrit l'information.
+ * \param[in]  information  L'information écrite.
+ * \return   Un tableau d'objets Traitement, éventuellement vide, rangés selon leur numéro.
+ */
+    Traitement* getUtilisations (Traitement* traitement, Information* information);
+
+
+    /**
+ * \brief    Indique le nombre de lectures d'informations qui peuvent ne pas avoir été initialisées.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned int getNbreLecturesNonInitialisees ();
+
+    /**
+ * \brief    Identifie les lectures d'informations qui peuvent ne pas avoir été initialisées.
+ * \details  Une lecture est signalée lorsque la définition fictive DEFINITION_INITIALE de l'information 
+ *           atteint le traitement qui la lit. \n
+ *           Par exemple, dans mainProf.cpp, la variable \c moyenne n'est écrite que si \c nombreDeNotes > 0 : 
+ *           sa lecture par le traitement "Afficher le résultat" est signalée (lecture non certaine).
+ * \return   Un tableau de getNbreLecturesNonInitialisees() enregistrements, rangés selon le numéro des traitements.
+ */
+    LectureNonInitialisee* getLecturesNonInitialisees ();
+
+
+    /**
+ * \brief    Indique le nombre de passes qui ont été nécessaires pour atteindre la stabilité, 
+ *           dernière passe (sans modification) comprise.
+ * \return   Un entier strictement positif.
+ */
+    unsigned int getNbrePasses ();
+
+
+private:
+    /**
+    \var Code* code
+    \brief le code analysé.
+*/
+    Code* code;
+
+    /**
+    \var AdjacenceCSR* successeurs
+    \brief pour chaque feuille, les feuilles qui s'exécutent après elle (déduites des liens Traitement::sontApres).
+*/
+    AdjacenceCSR* successeurs;
+
+    /**
+    \var AdjacenceCSR* predecesseurs
+    \brief pour chaque feuille, les feuilles après lesquelles elle s'exécute (transposée de successeurs).
+*/
+    AdjacenceCSR* predecesseurs;
+
+    /**
+    \var unsigned int nbreDefinitions
+    \brief le nombre de définitions du code, définitions fictives comprises.
+*/
+    unsigned int nbreDefinitions;
+
+    /**
+    \var Definition* definitions
+    \brief les définitions du code, rangées information par information.
+*/
+    Definition* definitions;
+
+    /**
+    \var unsigned int* debutsDefinitions
+    \brief pour chaque information, la position de sa première définition dans definitions 
+           (nombre d'informations + 1 cases).
+*/
+    unsigned int* debutsDefinitions;
+
+    /**
+    \var unsigned int nbreMotsParEnsemble
+    \brief le nombre de mots de 64 bits nécessaires pour représenter un ensemble de définitions.
+*/
+    unsigned int nbreMotsParEnsemble;
+
+    /**
+    \var unsigned long long int* atteignant
+    \brief pour chaque traitement, l'ensemble des définitions qui l'atteignent 
+           (nbreMotsParEnsemble mots par traitement, rangés les uns à la suite des autres).
+*/
+    unsigned long long int* atteignant;
+
+    /**
+    \var unsigned long long int* sortant
+    \brief pour chaque traitement, l'ensemble des définitions valides après son exécution.
+*/
+    unsigned long long int* sortant;
+
+    /**
+    \var unsigned int nbreLecturesNonInitialisees
+    \brief le nombre de lectures d'informations qui peuvent ne pas avoir été initialisées.
+*/
+    unsigned int nbreLecturesNonInitialisees;
+
+    /**
+    \var LectureNonInitialisee* lecturesNonInitialisees
+    \brief les lectures d'informations qui peuvent ne pas avoir été initialisées.
+*/
+    LectureNonInitialisee* lecturesNonInitialisees;
+
+    /**
+    \var unsigned int* ordre
+    \brief les numéros des feuilles, rangés en ordre postfixe inverse du graphe de flot.
+*/
+    unsigned int* ordre;
+
+    /**
+    \var unsigned int nbrePasses
+    \brief le nombre de passes nécessaires pour atteindre la stabilité.
+*/
+    unsigned int nbrePasses;
+};
+#endif
@@ -0,0 +1,139 @@
+/**
+ * \file      AnalyseNidsDeBoucles.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe AnalyseNidsDeBoucles.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe AnalyseNidsDeBoucles permettant de repérer
+ *             les boucles parcourant une collection imbriquées dans d'autres boucles parcourant une collection.
+ */
+
+#ifndef ANALYSE_NIDS_DE_BOUCLES_H
+#define ANALYSE_NIDS_DE_BOUCLES_H
+
+#include "Code.h"
+#include "Projet.h"
+#include "IterationAvecNombreDeRepetitionsConnu.h"
+
+/**
+ *  \struct NidDeBoucles
+ *  \brief Un enregistrement décrivant un nid de boucles dont le coût est au moins quadratique.
+ */
+struct NidDeBoucles
+{
+    /**
+    \var Code* code
+    \brief le code contenant le nid de boucles.
+*/
+    Code* code;
+
+    /**
+    \var Traitement* traitement
+    \brief le plus petit traitement contenant le nid de boucles.
+*/
+    Traitement* traitement;
+
+    /**
+    \var unsigned short int profondeur
+    \brief le nombre de boucles parcourant une collection imbriquées les unes dans les autres (au moins 2).
+*/
+    unsigned short int profondeur;
+
+    /**
+    \var IterationAvecNombreDeRepetitionsConnu** boucles
+    \brief les boucles du nid, de la plus externe à la plus interne (profondeur cases).
+*/
+    IterationAvecNombreDeRepetitionsConnu** boucles;
+
+    /**
+    \var VariableStructuree** collections
+    \brief pour chaque boucle du nid, la collection dont la taille borne le nombre d'itérations (profondeur cases).
+*/
+    VariableStructuree** collections;
+
+    /**
+    \var VariableSimple** indicesDeBoucle
+    \brief pour chaque boucle du nid, son IndiceDeBoucle, \c null pour un \c foreach (profondeur cases).
+*/
+    VariableSimple** indicesDeBoucle;
+
+    /**
+    \var bool memeCollection
+    \brief indique si au moins deux boucles du nid parcourent la même collection (recherche de doublons 
+           naïve par exemple), cas le plus souvent remplaçable par un tri ou une table de hachage.
+*/
+    bool memeCollection;
+};
+
+
+/**
+ *  \class AnalyseNidsDeBoucles
+ *  \brief Une classe pour repérer les boucles imbriquées dont chacune parcourt entièrement une collection.
+ *  \details Une boucle est retenue lorsqu'elle parcourt une VariableStructuree 
+ *           (voir IterationAvecNombreDeRepetitionsConnu::getCollectionParcourue()), ou lorsque sa borne
+ *           d'arrivée est la taille d'une VariableStructuree. \n
+ *           L'arbre aplati des structures de contrôle (voir ArbreStructures) est parcouru une seule fois en
+ *           tenant à jour la pile des boucles retenues englobant le nœud courant : un nid est signalé chaque 
+ *           fois qu'une boucle retenue est rencontrée alors que la pile n'est pas vide, et seul le nid le plus
+ *           profond d'une même branche est conservé. L'analyse est donc linéaire en le nombre de structures de 
+ *           contrôle ; pour un projet, les codes sont analysés en parallèle.
+ */
+class AnalyseNidsDeBoucles
+{
+public:
+/**
+ * \brief    Constructeur : prépare une analyse.
+ * \param[in] profondeurMinimum  La profondeur à partir de laquelle un nid est signalé (2 pour un coût quadratique).
+ */
+    AnalyseNidsDeBoucles (unsigned short int profondeurMinimum = 2);
+
+
+    /**
+ * \brief    Recherche les nids de boucles d'un code.
+ * \param[in]  code  Le code (figé) à analyser.
+ * \return   Le nombre de nids de boucles trouvés dans le code.
+ */
+    unsigned int analyser (Code* code);
+
+    /**
+ * \brief    Recherche les nids de boucles de tous les codes d'un projet.
+ * \param[in]  projet  Le projet à analyser.
+ * \param[in]  nbreFilsExecution  Le nombre de fils d'exécution à utiliser (0 pour le nombre de cœurs disponibles).
+ * \return   Le nombre de nids de boucles trouvés dans le projet.
+ */
+    unsigned int analyser (Projet* projet, unsigned short int nbreFilsExecution = 0);
+
+
+    /**
+ * \brief    Indique le nombre de nids de boucles trouvés.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned int getNbreNids ();
+
+    /**
+ * \brief    Donne accès aux nids de boucles trouvés.
+ * \return   Un tableau de getNbreNids() enregistrements, rangés code par code puis dans l'ordre d'apparition
+ *           de la boucle la plus externe.
+ */
+    NidDeBoucles* getNids ();
+
+
+private:
+    /**
+    \var unsigned short int profondeurMinimum
+    \brief la profondeur à partir de laquelle un nid est signalé.
+*/
+    unsigned short int profondeurMinimum;
+
+    /**
+    \var unsigned int nbreNids
+    \brief le nombre de nids de boucles trouvés.
+*/
+    unsigned int nbreNids;
+
+    /**
+    \var NidDeBoucles* nids
+    \brief les nids de boucles trouvés.
+*/
+    NidDeBoucles* nids;
+};
+#endif
@@ -0,0 +1,138 @@
+/**
+ * \file      AnalyseSiSiVersSwitch.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe AnalyseSiSiVersSwitch.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe AnalyseSiSiVersSwitch permettant de repérer
+ *             les structures Si-Si qui gagneraient à être écrites sous forme d'une structure \c switch.
+ */
+
+#ifndef ANALYSE_SI_SI_VERS_SWITCH_H
+#define ANALYSE_SI_SI_VERS_SWITCH_H
+
+#include "Code.h"
+#include "Projet.h"
+#include "StructureSiSi.h"
+#include "Valeur.h"
+
+/**
+ *  \struct CandidatSwitch
+ *  \brief Un enregistrement décrivant une structure Si-Si pouvant être remplacée par une structure \c switch.
+ */
+struct CandidatSwitch
+{
+    /**
+    \var Code* code
+    \brief le code contenant la structure.
+*/
+    Code* code;
+
+    /**
+    \var StructureSiSi* structure
+    \brief la structure Si-Si (ou Si-Si-Sinon) candidate.
+*/
+    StructureSiSi* structure;
+
+    /**
+    \var Information* discriminant
+    \brief l'information comparée à une constante dans chacune des ConditionSi de la structure.
+*/
+    Information* discriminant;
+
+    /**
+    \var unsigned int nbreComparaisons
+    \brief le nombre de comparaisons réalisées, dans le pire des cas, par la structure Si-Si.
+*/
+    unsigned int nbreComparaisons;
+
+    /**
+    \var unsigned int nbreComparaisonsEconomisees
+    \brief le nombre de comparaisons économisées, dans le pire des cas, par une structure \c switch 
+           compilée sous forme de table de sauts (une seule indirection), soit nbreComparaisons - 1.
+*/
+    unsigned int nbreComparaisonsEconomisees;
+};
+
+
+/**
+ *  \class AnalyseSiSiVersSwitch
+ *  \brief Une classe pour repérer les structures Si-Si dont toutes les ConditionSi comparent une même
+ *         information à des constantes.
+ *  \details Une structure est candidate lorsque l'expression de chacune de ses ConditionSi (voir TableExpressions) est :
+ *           - une égalité entre une même information (le discriminant) et une valeur de cas : une feuille 
+ *             OPERATEUR_LITTERAL, ou une Constante dont la valeur est connue (voir Constante::getValeur()) ;
+ *           - ou une disjonction ( \c || ) de telles égalités portant sur ce même discriminant.
+ *
+ *           Une structure \c switch n'acceptant que des valeurs entières, le type du discriminant doit être 
+ *           un type entier (entier signé ou non, caractère, booléen ou énumération) et chaque valeur de cas doit 
+ *           être de nature VALEUR_ENTIER, VALEUR_CARACTERE ou VALEUR_BOOLEEN : une comparaison portant sur un réel 
+ *           (comme \c valeurSaisie dans mainProf.cpp) exclut la structure. \n
+ *           Les valeurs de cas doivent toutes être différentes : elles sont comparées par valeur 
+ *           (voir Valeur::operator==()) et non par objet, à l'aide d'une table de hachage propre à la structure
+ *           (voir Valeur::getEmpreinte()). Deux NombreMagique distincts valant tous deux 1 excluent donc la structure. \n
+ *           L'analyse d'un code parcourt une seule fois l'arbre aplati de ses structures de contrôle 
+ *           (voir ArbreStructures) en ne retenant que les nœuds de nature NATURE_SI_SI ou NATURE_SI_SI_SINON :
+ *           elle est linéaire en le nombre de structures et de ConditionSi du code. Pour un projet, les
+ *           codes sont analysés en parallèle.
+ */
+class AnalyseSiSiVersSwitch
+{
+public:
+/**
+ * \brief    Constructeur : prépare une analyse.
+ * \param[in] nbreComparaisonsMinimum  Le nombre minimum de comparaisons pour qu'une structure soit signalée. \n
+ *           En deçà, une structure Si-Si est généralement aussi rapide qu'une structure \c switch.
+ */
+    AnalyseSiSiVersSwitch (unsigned int nbreComparaisonsMinimum = 4);
+
+
+    /**
+ * \brief    Recherche les structures candidates d'un code.
+ * \param[in]  code  Le code (figé) à analyser.
+ * \return   Le nombre de structures candidates trouvées dans le code.
+ */
+    unsigned int analyser (Code* code);
+
+    /**
+ * \brief    Recherche les structures candidates de tous les codes d'un projet.
+ * \param[in]  projet  Le projet à analyser.
+ * \param[in]  nbreFilsExecution  Le nombre de fils d'exécution à utiliser (0 pour le nombre de cœurs disponibles).
+ * \return   Le nombre de structures candidates trouvées dans le projet.
+ */
+    unsigned int analyser (Projet* projet, unsigned short int nbreFilsExecution = 0);
+
+
+    /**
+ * \brief    Indique le nombre de structures candidates trouvées.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned int getNbreCandidats ();
+
+    /**
+ * \brief    Donne accès aux structures candidates trouvées.
+ * \return   Un tableau de getNbreCandidats() enregistrements, rangés code par code puis dans l'ordre
+ *           d'apparition des structures dans le code.
+ */
+    CandidatSwitch* getCandidats ();
+
+
+private:
+    /**
+    \var unsigned int nbreComparaisonsMinimum
+    \brief le nombre minimum de comparaisons pour qu'une structure soit signalée.
+*/
+    unsigned int nbreComparaisonsMinimum;
+
+    /**
+    \var unsigned int nbreCandidats
+    \brief le nombre de structures candidates trouvées.
+*/
+    unsigned int nbreCandidats;
+
+    /**
+    \var CandidatSwitch* candidats
+    \brief les structures candidates trouvées.
+*/
+    CandidatSwitch* candidats;
+};
+#endif
@@ -0,0 +1,152 @@
+/**
+ * \file      ArbreStructures.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe ArbreStructures.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe ArbreStructures permettant de représenter,
+ *             sous forme d'un tableau, l'arbre de toutes les structures de contrôle d'un code.
+ */
+
+#ifndef ARBRE_STRUCTURES_H
+#define ARBRE_STRUCTURES_H
+
+#include "StructureDeControle.h"
+
+/**
+ *  \struct NoeudArbreStructures
+ *  \brief Un enregistrement décrivant une structure de contrôle et sa position dans l'arbre des structures d'un code.
+ */
+struct NoeudArbreStructures
+{
+    /**
+    \var StructureDeControle* structure
+    \brief la structure de contrôle représentée par le nœud.
+*/
+    StructureDeControle* structure;
+
+    /**
+    \var unsigned int tailleSousArbre
+    \brief le nombre de nœuds du sous-arbre issu de ce nœud, ce nœud compris. \n
+           Les descendants d'un nœud situé en position \c i occupent les positions \c i+1 à \c i+tailleSousArbre-1 ;
+           son frère suivant (s'il existe) se trouve en position \c i+tailleSousArbre.
+*/
+    unsigned int tailleSousArbre;
+
+    /**
+    \var unsigned int parent
+    \brief la position du nœud parent, ou la valeur NOEUD_RACINE pour une structure de premier niveau.
+*/
+    unsigned int parent;
+
+    /**
+    \var unsigned int traitement
+    \brief le numéro (voir Traitement::getNumero()) du plus petit traitement contenant la structure,
+           ou la valeur AUCUN_TRAITEMENT si la structure n'est contenue dans aucun traitement.
+*/
+    unsigned int traitement;
+
+    /**
+    \var unsigned short int profondeur
+    \brief le niveau d'imbrication de la structure (0 pour une structure de premier niveau).
+*/
+    unsigned short int profondeur;
+
+    /**
+    \var NatureStructure nature
+    \brief la nature de la structure, recopiée ici pour éviter d'accéder à l'objet StructureDeControle.
+*/
+    NatureStructure nature;
+};
+
+/**
+ * \brief    Valeur de NoeudArbreStructures::parent pour une structure de premier niveau.
+ */
+const unsigned int NOEUD_RACINE = 0xFFFFFFFF;
+
+/**
+ * \brief    Valeur de NoeudArbreStructures::traitement pour une structure contenue dans aucun traitement.
+ */
+const unsigned int AUCUN_TRAITEMENT = 0xFFFFFFFF;
+
+
+/**
+ *  \class ArbreStructures
+ *  \brief Une classe pour représenter l'arbre des structures de contrôle d'un code sous forme d'un tableau
+ *         de nœuds rangés en ordre préfixe.
+ *  \details Chaque nœud est rangé avant ses descendants, et les descendants d'un nœud sont rangés de manière
+ *           contiguë juste après lui. Ainsi :
+ *           - un parcours en profondeur de l'arbre est un simple parcours du tableau du début à la fin ;
+ *           - sauter le sous-arbre d'un nœud revient à avancer de NoeudArbreStructures::tailleSousArbre positions ;
+ *           - la profondeur maximale d'imbrication est le maximum des NoeudArbreStructures::profondeur.
+ *
+ *           Aucun de ces traitements ne nécessite de récursivité ni de suivre des pointeurs d'une
+ *           StructureImbriquee vers ses structures imbriquées.
+ */
+class ArbreStructures
+{
+public:
+/**
+ * \brief    Constructeur : construit l'arbre aplati à partir des structures de premier niveau d'un code.
+ * \details  Les StructureImbriquee sont parcourues une seule fois, à l'aide d'une pile explicite.
+ * \param[in] structures  Les structures de contrôle de premier niveau, dans leur ordre d'apparition dans le code.
+ * \param[in] nbreStructures  Le nombre de structures de premier niveau.
+ */
+    ArbreStructures (StructureDeControle** structures, unsigned int nbreStructures);
+
+
+    /**
+ * \brief    Indique le nombre de nœuds de l'arbre.
+ * \return   Un entier positif ou nul correspondant au nombre total de structures de contrôle du code.
+ */
+    unsigned int getNbreNoeuds ();
+
+    /**
+ * \brief    Donne accès aux nœuds de l'arbre.
+ * \return   Un tableau contigu de getNbreNoeuds() nœuds rangés en ordre préfixe.
+ */
+    const NoeudArbreStructures* getNoeuds ();
+
+
+    /**
+ * \brief    Indique la position du nœud suivant un nœud donné lorsque son sous-arbre est ignoré.
+ * \param[in]  position  La position du nœud dont le sous-arbre doit être ignoré.
+ * \return   La position du frère suivant du nœud, ou du premier nœud suivant son sous-arbre ;
+ *           getNbreNoeuds() si le sous-arbre se termine à la fin du tableau.
+ */
+    unsigned int sauterSousArbre (unsigned int position);
+
+
+    /**
+ * \brief    Indique la profondeur maximale d'imbrication des structures de contrôle du code.
+ * \return   Un entier positif ou nul (0 si aucune structure n'est imbriquée dans une autre).
+ */
+    unsigned short int getProfondeurMaximale ();
+
+    /**
+ * \brief    Indique la profondeur maximale d'imbrication au sein du sous-arbre d'un nœud.
+ * \param[in]  position  La position du nœud.
+ * \return   La profondeur maximale des nœuds du sous-arbre, relativement à la profondeur du nœud.
+ */
+    unsigned short int getProfondeurMaximale (unsigned int position);
+
+
+private:
+    /**
+    \var unsigned int nbreNoeuds
+    \brief le nombre de nœuds de l'arbre.
+*/
+    unsigned int nbreNoeuds;
+
+    /**
+    \var NoeudArbreStructures* noeuds
+    \brief les nœuds de l'arbre, rangés en ordre préfixe.
+*/
+    NoeudArbreStructures* noeuds;
+
+    /**
+    \var unsigned short int profondeurMaximale
+    \brief la profondeur maximale d'imbrication, calculée lors de la construction de l'arbre.
+*/
+    unsigned short int profondeurMaximale;
+};
+#endif
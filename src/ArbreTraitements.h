@@ -0,0 +1,174 @@
+/**
+ * \file      ArbreTraitements.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe ArbreTraitements.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe ArbreTraitements permettant de représenter,
+ *             sous forme d'un tableau, l'arbre des traitements composés et simples d'un code.
+ */
+
+#ifndef ARBRE_TRAITEMENTS_H
+#define ARBRE_TRAITEMENTS_H
+
+#include "Traitement.h"
+#include "IndexCommentaires.h"
+#include "ArbreStructures.h"
+
+/**
+ *  \struct NoeudArbreTraitements
+ *  \brief Un enregistrement décrivant un traitement et sa position dans l'arbre des traitements d'un code.
+ */
+struct NoeudArbreTraitements
+{
+    /**
+    \var Traitement* traitement
+    \brief le traitement représenté par le nœud.
+*/
+    Traitement* traitement;
+
+    /**
+    \var unsigned int tailleSousArbre
+    \brief le nombre de nœuds du sous-arbre issu de ce nœud, ce nœud compris. \n
+           Les sous-traitements (directs ou non) d'un nœud situé en position \c i occupent les positions 
+           \c i+1 à \c i+tailleSousArbre-1.
+*/
+    unsigned int tailleSousArbre;
+
+    /**
+    \var unsigned int parent
+    \brief la position du traitement composé contenant ce traitement, ou la valeur NOEUD_RACINE 
+           pour un traitement de premier niveau.
+*/
+    unsigned int parent;
+
+    /**
+    \var unsigned short int profondeur
+    \brief le niveau d'imbrication du traitement (0 pour un traitement de premier niveau).
+*/
+    unsigned short int profondeur;
+};
+
+
+/**
+ * \brief    Valeur donnée par ArbreTraitements::getPosition() à un traitement qui n'est délimité par aucun commentaire.
+ */
+const unsigned int AUCUNE_POSITION = 0xFFFFFFFF;
+
+
+/**
+ *  \class ArbreTraitements
+ *  \brief Une classe pour représenter l'arbre des traitements d'un code sous forme d'un tableau de nœuds 
+ *         rangés en ordre préfixe.
+ *  \details Les traitements d'un code sont délimités par des commentaires contenant un contrat, c'est-à-dire 
+ *           pour lesquels ContratTraitement::analyser() réussit (voir mainProf.cpp) :
+ *           - un commentaire \c /&lowast; ... &lowast;/ terminé par une ligne de tirets (bannière) ouvre un traitement ;
+ *           - un commentaire \c // placé seul sur sa ligne ouvre un traitement. 
+ *
+ *           Un commentaire sans contrat ( <tt>// Vérifier si l'utilisateur a demandé l'arrêt de la saisie</tt> ) 
+ *           n'ouvre aucun traitement. \n
+ *           Le niveau d'un traitement dépend de la profondeur d'accolades \c p à laquelle son commentaire est écrit 
+ *           (voir IndexCommentaires::getProfondeurAccolades()) : il vaut \c 2p pour une bannière et \c 2p+1 pour 
+ *           un commentaire \c // . Une bannière a donc toujours un niveau strictement inférieur à celui des 
+ *           commentaires \c // écrits à la même profondeur : dans mainProf.cpp, la bannière de la ligne 31 et le 
+ *           commentaire \c // de la ligne 34 sont tous deux à la profondeur 1, et le second est un sous-traitement 
+ *           du premier. \n
+ *           L'arbre est construit en une seule passe sur l'index des commentaires (voir IndexCommentaires),
+ *           à l'aide d'une pile des traitements ouverts : chaque commentaire délimitant un traitement referme 
+ *           les traitements de la pile dont le niveau est supérieur ou égal au sien, puis est empilé. Un traitement 
+ *           devient composé dès qu'un sous-traitement est empilé au-dessus de lui (voir Traitement::estCompose()). \n
+ *           L'ordre d'exécution est enregistré au cours de la même passe (voir Traitement::addTraitementApres()) :
+ *           - chaque entrée de la pile mémorise le dernier de ses fils refermé ; lorsqu'un nouveau fils est empilé,
+ *             il est ajouté aux traitements exécutés après ce frère précédent ;
+ *           - lorsqu'un traitement composé est refermé, ses fils contenus dans le corps d'une même structure 
+ *             itérative (voir ArbreStructures, dont chaque nœud indique le plus petit traitement qui le contient) 
+ *             sont reliés par un arc de retour : le premier de ces fils est ajouté aux traitements exécutés après 
+ *             le dernier. Dans mainProf.cpp, le traitement de la ligne 41 suit celui de la ligne 51.
+ *
+ *           La position de chaque traitement dans le tableau est mémorisée dans une table indexée par son numéro 
+ *           (voir getPosition()) : le numéro d'un traitement, attribué à sa construction, ne correspond pas à sa 
+ *           position lorsque des traitements (fonctions, méthodes...) ne sont délimités par aucun commentaire 
+ *           ou ont été créés dans un autre ordre. Savoir si un traitement est un ancêtre d'un autre se fait 
+ *           donc en temps constant, sans parcourir l'arbre.
+ */
+class ArbreTraitements
+{
+public:
+/**
+ * \brief    Constructeur : construit l'arbre aplati des traitements d'un code.
+ * \param[in] code  Le code dont les commentaires ont été extraits (voir Code::getIndexCommentaires()) 
+ *            et dont l'arbre des structures est construit (voir Code::getArbreStructures()).
+ */
+    ArbreTraitements (Code* code);
+
+
+    /**
+ * \brief    Indique le nombre de nœuds de l'arbre.
+ * \return   Un entier positif ou nul correspondant au nombre total de traitements du code.
+ */
+    unsigned int getNbreNoeuds ();
+
+    /**
+ * \brief    Donne accès aux nœuds de l'arbre.
+ * \return   Un tableau contigu de getNbreNoeuds() nœuds rangés en ordre préfixe.
+ */
+    const NoeudArbreTraitements* getNoeuds ();
+
+    /**
+ * \brief    Indique la position d'un traitement dans le tableau des nœuds.
+ * \param[in]  traitement  Le traitement recherché.
+ * \return   La position du nœud du traitement, ou AUCUNE_POSITION si le traitement n'est délimité par aucun commentaire.
+ */
+    unsigned int getPosition (Traitement* traitement);
+
+
+    /**
+ * \brief    Indique si un traitement est un ancêtre (direct ou non) d'un autre traitement.
+ * \param[in]  ancetre  La position du traitement supposé ancêtre.
+ * \param[in]  descendant  La position du traitement supposé descendant.
+ * \return   \c true si le second traitement est contenu dans le premier, \c false sinon.
+ */
+    bool estAncetre (unsigned int ancetre, unsigned int descendant);
+
+    /**
+ * \brief    Indique la position du nœud suivant un nœud donné lorsque son sous-arbre est ignoré.
+ * \param[in]  position  La position du nœud dont le sous-arbre doit être ignoré.
+ * \return   La position du premier nœud suivant le sous-arbre ; getNbreNoeuds() si le sous-arbre se termine 
+ *           à la fin du tableau.
+ */
+    unsigned int sauterSousArbre (unsigned int position);
+
+
+    /**
+ * \brief    Indique la profondeur maximale d'imbrication des traitements du code.
+ * \return   Un entier positif ou nul (0 si aucun traitement n'est composé).
+ */
+    unsigned short int getProfondeurMaximale ();
+
+
+private:
+    /**
+    \var unsigned int nbreNoeuds
+    \brief le nombre de nœuds de l'arbre.
+*/
+    unsigned int nbreNoeuds;
+
+    /**
+    \var NoeudArbreTraitements* noeuds
+    \brief les nœuds de l'arbre, rangés en ordre préfixe.
+*/
+    NoeudArbreTraitements* noeuds;
+
+    /**
+    \var unsigned int* positions
+    \brief la position de chaque traitement dans le tableau des nœuds, indexée par le numéro du traitement
+           (voir Traitement::getNumero()), AUCUNE_POSITION pour un traitement absent de l'arbre.
+*/
+    unsigned int* positions;
+
+    /**
+    \var unsigned short int profondeurMaximale
+    \brief la profondeur maximale d'imbrication, calculée lors de la construction de l'arbre.
+*/
+    unsigned short int profondeurMaximale;
+};
+#endif
@@ -0,0 +1,173 @@
+/**
+ * \file      ArenaCode.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe ArenaCode.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe ArenaCode permettant de stocker,
+ *             dans une même zone mémoire, tous les objets issus de l'analyse d'un Code ainsi que les
+ *             liens qui les relient.
+ */
+
+#ifndef ARENA_CODE_H
+#define ARENA_CODE_H
+
+/**
+ * \brief    Index (sur 32 bits) désignant un objet ou une liste stocké(e) dans une ArenaCode.
+ * \details  Un index n'est pas une adresse : il désigne un octet de l'espace d'adressage virtuel de l'arène,
+ *           dans lequel le bloc numéro \c b occupe les positions \c b × tailleBloc à \c (b+1) × tailleBloc - 1.
+ *           La taille des blocs étant une puissance de 2, le numéro du bloc et le décalage dans ce bloc sont
+ *           obtenus par un simple décalage et un masque de bits, puis l'adresse par une lecture dans le tableau
+ *           des blocs. Le graphe d'objets d'un Code reste donc valide si les blocs sont déplacés en mémoire.
+ */
+typedef unsigned int IndexNoeud;
+
+/**
+ * \brief    Valeur d'un IndexNoeud ne désignant aucun objet (équivalent de la valeur \c null pour un pointeur).
+ */
+const IndexNoeud INDEX_NUL = 0xFFFFFFFF;
+
+
+/**
+ *  \class ArenaCode
+ *  \brief Une classe pour allouer les objets (Information, Traitement, Commentaire, Type, StructureDeControle...)
+ *         d'un Code dans une zone mémoire unique.
+ *  \details L'arène est constituée de grands blocs mémoire, tous de même taille, dans lesquels les objets sont 
+ *           placés les uns après les autres, dans l'ordre de leur création par l'analyse. Un objet n'est jamais
+ *           placé à cheval sur deux blocs : si la place restante dans le bloc courant ne suffit pas, elle est
+ *           abandonnée et l'objet est placé au début d'un nouveau bloc. Un objet plus grand qu'un bloc reçoit
+ *           plusieurs numéros de blocs consécutifs, correspondant à une seule zone mémoire contiguë. Les objets ne sont jamais libérés
+ *           individuellement : tous les blocs sont libérés en une seule fois lors de la destruction de l'arène,
+ *           c'est-à-dire lors de la destruction du Code auquel elle appartient. \n
+ *           Les liens entre objets (informations d'un traitement, traitements d'une information...) sont eux
+ *           aussi stockés dans l'arène, sous forme de listes d'IndexNoeud. Une liste est désignée par l'index
+ *           de son en-tête (nombre d'éléments, capacité, index du tableau des éléments), qui ne change jamais :
+ *           lorsque le tableau des éléments est plein, un tableau de capacité double est alloué, les éléments y
+ *           sont recopiés et seul l'en-tête est mis à jour. Les index de liste conservés dans les objets restent
+ *           donc valides. L'ancien tableau est placé dans une liste de tableaux libres, une par capacité 
+ *           (puissance de 2), et réutilisé par la prochaine liste qui atteint cette capacité.
+ */
+class ArenaCode
+{
+public:
+/**
+ * \brief    Constructeur : construit une arène vide.
+ * \param[in] tailleBloc  La taille (en octets) de chacun des blocs mémoire réservés par l'arène. \n
+ *           Cette taille doit être une puissance de 2. Un nouveau bloc n'est réservé que lorsque le bloc 
+ *           courant est plein. L'espace d'adressage d'une arène est limité à 4 Go (index sur 32 bits).
+ */
+    ArenaCode (unsigned int tailleBloc = 1 << 20);
+
+/**
+ * \brief    Destructeur : libère en une seule fois tous les blocs mémoire de l'arène,
+ *           et donc tous les objets et toutes les listes qu'elle contient.
+ */
+    ~ArenaCode ();
+
+
+    /**
+ * \brief    Réserve, dans l'arène, l'espace nécessaire pour stocker un objet.
+ * \param[in]  taille  La taille (en octets) de l'objet à stocker.
+ * \param[in]  alignement  L'alignement (en octets) exigé par l'objet à stocker.
+ * \return   L'index désignant l'espace réservé, dans lequel l'objet doit ensuite être construit.
+ */
+    IndexNoeud allouer (unsigned int taille, unsigned int alignement);
+
+
+    /**
+ * \brief    Donne l'adresse de l'objet désigné par un index.
+ * \details  L'adresse retournée n'est valide que tant que l'arène n'est pas déplacée : seuls les index
+ *           doivent être conservés au sein du graphe d'objets.
+ * \param[in]  index  L'index désignant l'objet.
+ * \return   L'adresse de l'objet, ou la valeur \c null si l'index vaut INDEX_NUL.
+ */
+    void* getAdresse (IndexNoeud index);
+
+
+    /**
+ * \brief    Crée, dans l'arène, une liste d'index vide.
+ * \return   L'index désignant la liste créée.
+ */
+    IndexNoeud creerListe ();
+
+    /**
+ * \brief    Indique le nombre d'éléments contenus dans une liste d'index.
+ * \param[in]  liste  L'index désignant la liste.
+ * \return   Un entier positif ou nul correspondant au nombre d'éléments de la liste.
+ */
+    unsigned int getNbreElements (IndexNoeud liste);
+
+    /**
+ * \brief    Donne accès aux éléments d'une liste d'index.
+ * \param[in]  liste  L'index désignant la liste.
+ * \return   Un tableau contigu de getNbreElements() index.
+ */
+    IndexNoeud* getElements (IndexNoeud liste);
+
+    /**
+ * \brief    Ajoute un index à la fin d'une liste d'index.
+ * \param[in]  liste  L'index désignant la liste.
+ * \param[in]  element  L'index à ajouter à la liste.
+ */
+    void ajouterElement (IndexNoeud liste, IndexNoeud element);
+
+    /**
+ * \brief    Retire un index d'une liste d'index.
+ * \details  Les éléments suivants sont décalés d'une case : l'ordre des éléments est conservé.
+ * \param[in]  liste  L'index désignant la liste.
+ * \param[in]  element  L'index à retirer de la liste.
+ */
+    void retirerElement (IndexNoeud liste, IndexNoeud element);
+
+
+    /**
+ * \brief    Indique le nombre d'allocations mémoire réalisées par l'arène auprès du système.
+ * \return   Un entier positif ou nul correspondant au nombre de blocs réservés par l'arène.
+ */
+    unsigned int getNbreBlocs ();
+
+    /**
+ * \brief    Indique la place occupée dans l'arène.
+ * \return   Un entier positif ou nul correspondant au nombre d'octets occupés par les objets et les listes.
+ */
+    unsigned long int getTailleOccupee ();
+
+
+private:
+    /**
+    \var unsigned int tailleBloc
+    \brief la taille (en octets) de chacun des blocs réservés par l'arène.
+*/
+    unsigned int tailleBloc;
+
+    /**
+    \var unsigned short int decalageBloc
+    \brief le logarithme en base 2 de tailleBloc : le numéro du bloc désigné par un index est index >> decalageBloc.
+*/
+    unsigned short int decalageBloc;
+
+    /**
+    \var char** blocs
+    \brief l'adresse de chaque bloc, indexée par numéro de bloc (un grand objet occupe plusieurs cases consécutives).
+*/
+    char** blocs;
+
+    /**
+    \var unsigned int nbreBlocs
+    \brief le nombre de blocs mémoire réservés par l'arène.
+*/
+    unsigned int nbreBlocs;
+
+    /**
+    \var unsigned int positionBlocCourant
+    \brief la position, dans le dernier bloc réservé, à partir de laquelle le prochain objet sera placé.
+*/
+    unsigned int positionBlocCourant;
+
+    /**
+    \var IndexNoeud tableauxLibres[32]
+    \brief pour chaque capacité 2^k, le premier tableau d'éléments de liste libéré lors d'un agrandissement
+           (les tableaux libres d'une même capacité sont chaînés entre eux), ou INDEX_NUL.
+*/
+    IndexNoeud tableauxLibres[32];
+};
+#endif
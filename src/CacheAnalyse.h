@@ -0,0 +1,108 @@
+/**
+ * \file      CacheAnalyse.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe CacheAnalyse.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe CacheAnalyse permettant de conserver
+ *             sur disque le résultat de l'analyse de codes source afin de ne pas les analyser à nouveau
+ *             tant qu'ils n'ont pas été modifiés.
+ */
+
+#ifndef CACHE_ANALYSE_H
+#define CACHE_ANALYSE_H
+
+#include "Code.h"
+
+/**
+ * \brief    Version de l'analyseur ayant produit un instantané.
+ * \details  Cette valeur doit être incrémentée à chaque évolution de l'analyse ou du format des instantanés :
+ *           les instantanés produits par une autre version sont alors ignorés.
+ */
+const unsigned int VERSION_ANALYSEUR = 2;
+
+
+/**
+ *  \class CacheAnalyse
+ *  \brief Une classe pour conserver, dans un répertoire local, des instantanés de codes déjà analysés.
+ *  \details Un instantané est une sérialisation d'un Code figé (voir Code::enregistrerInstantane()). 
+ *           Ce n'est pas une copie de la mémoire du code : les objets à méthodes virtuelles, les pointeurs
+ *           (Code*, Type*), les vues sur le fichier projeté ou sur la table des identifiants et les numéros 
+ *           de noms (IdIdentifiant, propres à une exécution) n'y figurent que sous une forme indépendante 
+ *           de l'adresse et de l'exécution. Relire un instantané reconstruit donc les objets un à un, mais 
+ *           évite la lecture et l'analyse du fichier source. \n
+ *           Chaque instantané est identifié par une clé formée de l'empreinte du contenu du fichier source
+ *           (voir Code::getEmpreinteSource()) et de la version de l'analyseur (VERSION_ANALYSEUR). \n
+ *           Un instantané absent, produit par une autre version de l'analyseur ou corrompu (somme de contrôle
+ *           incorrecte, taille incohérente...) est ignoré : le fichier source est alors analysé normalement
+ *           et un nouvel instantané est enregistré à la place de l'ancien.
+ */
+class CacheAnalyse
+{
+public:
+/**
+ * \brief    Constructeur : ouvre (et crée si besoin) un répertoire de cache.
+ * \param[in] cheminRepertoire  Le chemin d'accès au répertoire contenant les instantanés. \n
+ *           Par exemple : "/home/pierre/.cache/code-explorer"
+ */
+    CacheAnalyse (string cheminRepertoire);
+
+
+    /**
+ * \brief    Indique le chemin d'accès au répertoire contenant les instantanés.
+ * \return   Une chaine de caractères correspondant au chemin d'accès du répertoire.
+ */
+    string getCheminRepertoire ();
+
+
+    /**
+ * \brief    Fournit le code correspondant à un fichier source, en le relisant depuis le cache si possible.
+ * \details  Si aucun instantané valide ne correspond au contenu actuel du fichier, le fichier est analysé
+ *           (voir Code::Code(string)) et l'instantané du code obtenu est enregistré dans le cache.
+ * \param[in]  cheminFichier  Le chemin d'accès au fichier contenant le code source.
+ * \return   Un objet Code, identique à celui qu'aurait produit l'analyse du fichier.
+ */
+    Code* getCode (string cheminFichier);
+
+
+    /**
+ * \brief    Enregistre l'instantané d'un code dans le cache.
+ * \details  L'instantané est d'abord écrit dans un fichier temporaire puis renommé : un autre processus
+ *           lisant le cache au même moment ne peut donc jamais lire un instantané partiellement écrit.
+ * \param[in]  code  Le code (figé) dont l'instantané doit être enregistré.
+ */
+    void enregistrer (Code* code);
+
+
+    /**
+ * \brief    Indique combien de codes ont été relus depuis le cache depuis sa création.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned int getNbreSucces ();
+
+    /**
+ * \brief    Indique combien de codes ont dû être analysés faute d'instantané valide depuis la création du cache.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned int getNbreEchecs ();
+
+
+private:
+    /**
+    \var string cheminRepertoire
+    \brief le chemin d'accès au répertoire contenant les instantanés.
+*/
+    string cheminRepertoire;
+
+    /**
+    \var unsigned int nbreSucces
+    \brief le nombre de codes relus depuis le cache.
+*/
+    unsigned int nbreSucces;
+
+    /**
+    \var unsigned int nbreEchecs
+    \brief le nombre de codes analysés faute d'instantané valide.
+*/
+    unsigned int nbreEchecs;
+};
+#endif
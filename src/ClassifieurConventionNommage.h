@@ -0,0 +1,96 @@
+/**
+ * \file      ClassifieurConventionNommage.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe ClassifieurConventionNommage.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe ClassifieurConventionNommage permettant
+ *             de déterminer, en une seule passe, la convention de nommage d'un grand nombre de noms.
+ */
+
+#ifndef CLASSIFIEUR_CONVENTION_NOMMAGE_H
+#define CLASSIFIEUR_CONVENTION_NOMMAGE_H
+
+#include "TableIdentifiants.h"
+
+/**
+ *  \enum ConventionNommage
+ *  \brief Les conventions de nommage reconnues pour nommer une information.
+ *  \details Pour plus d’infos sur les 4 premiers styles : \n
+ *           <https://medium.com/better-programming/string-case-styles-camel-pascal-snake-and-kebab-case-981407998841>
+ */
+enum ConventionNommage
+{
+    CAMEL_CASE,      /**< "camelCase" : commence par une minuscule, contient au moins une majuscule, ni '_' ni '-' */
+    PASCAL_CASE,     /**< "pascalCase" : commence par une majuscule, contient au moins une minuscule, ni '_' ni '-' */
+    SNAKE_CASE,      /**< "snakeCase" : minuscules et chiffres séparés par des '_' ; un nom formé d'un seul mot 
+                          en minuscules (par exemple "moyenne") est rangé dans cette convention */
+    KEBAB_CASE,      /**< "kebabCase" : minuscules et chiffres séparés par des '-', au moins un '-' */
+    UNDEFINED_STYLE  /**< "undefinedStyle" : aucun des styles précédents */
+};
+
+
+/**
+ *  \class ClassifieurConventionNommage
+ *  \brief Une classe pour déterminer la convention de nommage de noms, un par un ou par lots.
+ *  \details La convention de nommage d'un nom ne dépend que des classes de caractères qu'il contient
+ *           (majuscule, minuscule, '_', '-', chiffre, autre) et de la classe de son premier caractère. \n
+ *           Pour un lot de noms rangés les uns à la suite des autres (comme dans une TableIdentifiants),
+ *           les classes de caractères sont calculées 16 ou 32 octets à la fois à l'aide d'instructions
+ *           SIMD (SSE2 / AVX2 sur x86, NEON sur ARM) : chaque classe donne un masque de bits, et les masques
+ *           sont ensuite cumulés nom par nom. Lorsque ces instructions ne sont pas disponibles, le même
+ *           calcul est réalisé caractère par caractère ; les deux versions donnent toujours le même résultat.
+ */
+class ClassifieurConventionNommage
+{
+public:
+    /**
+ * \brief    Détermine la convention de nommage d'un nom.
+ * \param[in]  nom  Le nom à classer. \n
+ *           Par exemple : "sommeNotes"
+ * \return   La convention de nommage du nom (CAMEL_CASE pour l'exemple ci-dessus).
+ */
+    static ConventionNommage classer (string_view nom);
+
+
+    /**
+ * \brief    Détermine la convention de nommage de plusieurs noms en une seule passe.
+ * \param[in]  noms  Les noms à classer.
+ * \param[in]  nbreNoms  Le nombre de noms à classer.
+ * \param[out] conventions  Le tableau (nbreNoms cases) dans lequel est rangée la convention de chaque nom.
+ */
+    static void classer (const string_view* noms, unsigned int nbreNoms, ConventionNommage* conventions);
+
+
+    /**
+ * \brief    Détermine la convention de nommage de certains noms d'une table d'identifiants.
+ * \details  C'est cette méthode qui fournit à chaque Information sa convention de nommage à la fin de 
+ *           l'analyse d'un Code : elle ne reçoit que les noms des informations de ce code, chacun une seule 
+ *           fois quel que soit son nombre d'occurrences. Les autres chaînes de la table (noms d'informations 
+ *           d'autres codes du projet, littéraux, actions des contrats) ne sont pas classées. \n
+ *           Les noms sont lus par getNom(), qui ne prend pas de verrou : la méthode peut être appelée par
+ *           plusieurs fils d'exécution partageant la même table (voir Projet).
+ * \param[in]  table  La table contenant les noms à classer.
+ * \param[in]  ids  Les numéros des noms à classer, sans doublon.
+ * \param[in]  nbreIds  Le nombre de noms à classer.
+ * \param[out] conventions  Le tableau (nbreIds cases) dans lequel est rangée la convention de chaque nom,
+ *           à la même position que son numéro dans ids.
+ */
+    static void classer (TableIdentifiants* table, const IdIdentifiant* ids, unsigned int nbreIds,
+                         ConventionNommage* conventions);
+
+
+    /**
+ * \brief    Indique le nom d'une convention de nommage.
+ * \param[in]  convention  La convention de nommage.
+ * \return   Une chaine de caractères parmi "camelCase", "pascalCase", "snakeCase", "kebabCase" et "undefinedStyle".
+ */
+    static string_view getNom (ConventionNommage convention);
+
+
+    /**
+ * \brief    Indique si la classification par lots utilise des instructions SIMD sur la machine courante.
+ * \return   \c true si des instructions SIMD sont utilisées, \c false si la version caractère par caractère est utilisée.
+ */
+    static bool estVectorise ();
+};
+#endif
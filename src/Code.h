@@ -13,9 +13,34 @@
 #define CODE_H
 
 #include "Information.h"
+#include "NombreMagique.h"
+#include "Valeur.h"
 #include "Traitement.h"
 #include "Commentaire.h"
+#include "IndexCommentaires.h"
 #include "Librairie.h"
+#include "FichierSource.h"
+#include "ArenaCode.h"
+#include "GrapheFluxDeDonnees.h"
+#include "ModificationTexte.h"
+#include "TableIdentifiants.h"
+#include "TableTypes.h"
+#include "ArbreStructures.h"
+#include "ArbreTraitements.h"
+#include "TableExpressions.h"
+#include "EvaluateurExpressions.h"
+
+class Projet;
+
+/**
+ *  \enum ModeChargement
+ *  \brief Les façons dont un code peut être chargé.
+ */
+enum ModeChargement
+{
+    CHARGEMENT_COMPLET,    /**< le code est entièrement décomposé dès sa construction */
+    CHARGEMENT_PARESSEUX   /**< le corps des traitements n'est décomposé que lorsqu'il est consulté */
+};
 
 /** 
  *  \class Code
@@ -30,11 +55,108 @@ public:
  * \details  Le fichier contenant le code à charger est défini à partir de son nom système. \n
  *           Le code chargé est analysé et décomposé en objets (Information, Traitement, Commentaire...)
  *           reliés entre eux (tel Commentaire est associé à telle Information, telle Information
- *           intervient dans tel Traitement...)  
+ *           intervient dans tel Traitement...)  \n
+ *           Le fichier est projeté en mémoire (voir FichierSource) et analysé en une seule passe : 
+ *           les lexèmes sont extraits directement depuis les octets projetés, sans copie du contenu
+ *           au sein d'une chaîne de caractères, et les objets Information, Traitement et Commentaire 
+ *           sont construits au fur et à mesure de la lecture. L'occupation mémoire reste ainsi proche 
+ *           de la taille des objets produits, quelle que soit la taille du fichier.
+ *           En mode CHARGEMENT_PARESSEUX, cette passe se limite à repérer les déclarations d'informations 
+ *           (variables, constantes), les librairies, les limites des Traitement et l'étendue des Commentaire. 
+ *           Le corps d'un traitement (StructureDeControle, nombres magiques, liens donnée / résultat) n'est 
+ *           décomposé que lors du premier accès à l'un de ces éléments, puis conservé (voir Traitement::decomposer()).
  * \param[in] cheminFichier  Le chemin d'accès au fichier contenant le code source. \n
  *           Par exemple : "/home/pierre/prog/helloWorld.php"
+ * \param[in] mode  La façon dont le code doit être chargé.
+ */
+    Code (string cheminFichier, ModeChargement mode = CHARGEMENT_COMPLET);
+
+/**
+ * \brief    Constructeur : charge un code se trouvant au sein d'un fichier appartenant à un projet.
+ * \details  Le code est analysé comme avec le constructeur Code(string), mais les objets Type et Librairie
+ *           sont recherchés puis, si besoin, ajoutés dans les registres partagés par tous les codes du projet.
+ * \param[in] cheminFichier  Le chemin d'accès au fichier contenant le code source.
+ * \param[in] projet  Le projet auquel appartient le code.
+ * \param[in] mode  La façon dont le code doit être chargé.
+ */
+    Code (string cheminFichier, Projet* projet, ModeChargement mode = CHARGEMENT_COMPLET);
+
+    /**
+ * \brief    Indique la façon dont le code a été chargé.
+ * \return   Une valeur de l'énumération ModeChargement.
+ */
+    ModeChargement getModeChargement ();
+
+    /**
+ * \brief    Indique si tous les traitements du code ont été décomposés.
+ * \return   \c true si le code a été chargé en mode CHARGEMENT_COMPLET ou si tous ses traitements ont 
+ *           depuis été décomposés, \c false sinon.
+ */
+    bool estMaterialise ();
+
+    /**
+ * \brief    Indique combien de traitements du code ont déjà été décomposés.
+ * \return   Un entier compris entre 0 et le nombre de traitements du code.
+ */
+    unsigned int getNbreTraitementsDecomposes ();
+
+    /**
+ * \brief    Décompose tous les traitements du code qui ne l'ont pas encore été.
+ * \details  Après cet appel, le code est dans le même état que s'il avait été chargé en mode CHARGEMENT_COMPLET.
+ */
+    void materialiser ();
+
+    /**
+ * \brief    Indique le projet auquel appartient le code.
+ * \return   Un objet Projet, ou la valeur \c null si le code a été chargé seul.
+ */
+    Projet* getProjet ();
+
+/**
+ * \brief    Destructeur : libère en une seule fois tous les objets issus de l'analyse du code.
+ * \details  Les objets Information, Traitement, Commentaire, StructureDeControle... du code sont tous
+ *           alloués dans l'arène du code (voir ArenaCode) : ils ne sont pas libérés un à un mais
+ *           disparaissent avec l'arène.
+ */
+    ~Code ();
+
+    /**
+ * \brief    Donne accès à l'arène dans laquelle sont alloués les objets issus de l'analyse du code.
+ * \return   L'objet ArenaCode du code.
+ */
+    ArenaCode* getArena ();
+
+    /**
+ * \brief    Donne accès à la table dans laquelle sont stockés les noms (informations, traitements, types...) du code.
+ * \details  Si le code appartient à un projet, la table est celle du projet (voir Projet::getTableIdentifiants()) :
+ *           un nom utilisé dans plusieurs fichiers n'est alors stocké qu'une seule fois.
+ * \return   L'objet TableIdentifiants du code.
+ */
+    TableIdentifiants* getTableIdentifiants ();
+
+    /**
+ * \brief    Donne accès à la table des types du code.
+ * \details  Si le code appartient à un projet, la table est celle du projet (voir Projet::getTableTypes()).
+ * \return   L'objet TableTypes du code.
+ */
+    TableTypes* getTableTypes ();
+
+    /**
+ * \brief    Donne accès à la table des expressions du code.
+ * \details  Les expressions des ConditionSi du code y sont stockées sous forme d'un graphe dans lequel
+ *           chaque sous-expression n'apparaît qu'une seule fois : deux conditions identiques du code 
+ *           portent le même numéro d'expression (voir ConditionSi::getExpression()).
+ * \return   L'objet TableExpressions du code.
  */
-    Code (string cheminFichier);
+    TableExpressions* getTableExpressions ();
+
+    /**
+ * \brief    Donne accès à l'évaluateur des expressions du code.
+ * \details  L'évaluateur mémorise la valeur de chaque expression déjà évaluée : il est partagé par toutes 
+ *           les analyses du code qui ont besoin de connaître la valeur d'une condition.
+ * \return   L'objet EvaluateurExpressions du code.
+ */
+    EvaluateurExpressions* getEvaluateurExpressions ();
 
     /**
  * \brief    Indique le chemin d'accès du fichier contenant le code source.
@@ -48,6 +170,13 @@ public:
  */
     void setCheminFichier (string cheminFichier);
 
+    /**
+ * \brief    Donne accès au fichier projeté en mémoire à partir duquel le code a été chargé, ou à sa version 
+ *           modifiée la plus récente (voir appliquerModification()).
+ * \return   Un objet FichierSource permettant de consulter le contenu du fichier sans le recopier.
+ */
+    FichierSource* getFichierSource ();
+
 
 
 /**
@@ -91,10 +220,24 @@ public:
  *             - "accu" pour compter uniquement les variables de type accumulateur;  \n
  *             - "count" pour compter uniquement les variables de type compteur; \n
  *             - "index" pour compter uniquement les variables de type indice de boucle.  
- * \return   Un entier positif ou nul indiquant le nombre de d'informations utilisée dans le code.
+ * \return   Un entier positif ou nul indiquant le nombre de d'informations utilisée dans le code. \n
+ *           En mode CHARGEMENT_PARESSEUX, compter les constantes ou les variables ne nécessite pas de décomposer
+ *           les traitements ; compter les nombres magiques ou les rôles (accumulateur, compteur, indice de boucle)
+ *           décompose tous les traitements non encore décomposés. \n
+ *           Cette méthode convertit le paramètre en une valeur de CategorieInformation puis appelle
+ *           getNbreInformations(CategorieInformation).
  */
     unsigned short int getNbreInformations(string typeInformation);
 
+/**
+ * \brief    Identifie le nombre d'informations d'une catégorie utilisées dans le code.
+ * \details  Le nombre d'informations de chaque catégorie est tenu à jour par addInformation(), 
+ *           removeInformation() et reclasserInformation() : il est obtenu sans parcourir les informations du code.
+ * \param[in]  categorie  La catégorie d'information à compter (CATEGORIE_TOUTES pour compter toutes les informations).
+ * \return   Un entier positif ou nul indiquant le nombre d'informations de la catégorie demandée.
+ */
+    unsigned short int getNbreInformations(CategorieInformation categorie);
+
 /**
  * \brief    Identifie les informations utilisées dans le code source.
  * \details  Les informations identifiées peuvent être de tout type : il peut s'agir \n
@@ -117,18 +260,92 @@ public:
 
     Information* getInformations(string typeInformation);
 
+/**
+ * \brief    Identifie les informations d'une catégorie utilisées dans le code source.
+ * \details  Chaque catégorie dispose de son propre index, tenu à jour par addInformation(), removeInformation() et 
+ *           reclasserInformation() : seules les informations de la catégorie demandée sont parcourues. \n
+ *           La méthode getInformations(string) convertit son paramètre en une valeur de CategorieInformation 
+ *           puis appelle cette méthode.
+ * \param[in]  categorie  La catégorie d'information à récupérer (CATEGORIE_TOUTES pour récupérer toutes les informations).
+ * \return   Un tableau d'objets Information appartenant à la catégorie demandée. \n
+ *           Le tableau retourné peut être vide si aucune information de la catégorie demandée n'est utilisée dans le code.
+ */
+    Information* getInformations(CategorieInformation categorie);
+
+    /**
+ * \brief    Recherche l'information d'un nom donné visible à une position du code.
+ * \details  Les informations sont rangées dans une table de hachage indexée par le numéro de leur nom
+ *           (voir Information::getIdNom()) ; les informations de même nom déclarées dans des blocs différents
+ *           sont chaînées dans la même entrée. Parmi elles, seules sont retenues celles dont la portée 
+ *           (voir Information::getPortee()) contient la position et dont la déclaration la précède ; 
+ *           la plus imbriquée est renvoyée. La recherche ne parcourt donc pas la liste des informations. \n
+ *           C'est cette recherche qui permet de relier les noms cités dans le contrat d'un traitement
+ *           (voir ContratTraitement) aux informations du code : la position utilisée est celle du contrat. \n
+ *           En mode CHARGEMENT_PARESSEUX, les déclarations d'informations, locales comprises, sont relevées dès 
+ *           le chargement (voir Code()) : la recherche ne nécessite donc la décomposition d'aucun traitement.
+ * \param[in]  nom  Le nom de l'information recherchée. \n
+ *             Par exemple : "sommeNotes"
+ * \param[in]  position  La position, en octets depuis le début du fichier, à partir de laquelle le nom est cité.
+ * \return   L'objet Information portant ce nom et visible à cette position, ou la valeur \c null s'il n'y en a pas.
+ */
+    Information* getInformationParNom(string_view nom, unsigned long int position);
+
+
+    /**
+ * \brief    Indique le nombre de nombres magiques du code ayant une valeur donnée.
+ * \param[in]  valeur  La valeur recherchée. \n
+ *             Par exemple : Valeur(20)
+ * \return   Un entier positif ou nul.
+ */
+    unsigned short int getNbreNombresMagiques(Valeur valeur);
+
+    /**
+ * \brief    Regroupe les nombres magiques du code ayant une valeur donnée.
+ * \details  Les nombres magiques sont rangés dans une table de hachage indexée par leur valeur
+ *           (voir Valeur::getEmpreinte()), construite lors du premier appel : la recherche des 
+ *           doublons d'une valeur ne parcourt donc pas toutes les informations du code. \n
+ *           En mode CHARGEMENT_PARESSEUX, ce premier appel décompose d'abord tous les traitements non encore 
+ *           décomposés (voir materialiser()), afin que la table contienne tous les nombres magiques du code. 
+ *           La table est abandonnée, puis reconstruite lors de l'appel suivant, lorsqu'un nombre magique est 
+ *           ajouté ou supprimé (voir addInformation(), removeInformation() et appliquerModification()).
+ * \param[in]  valeur  La valeur recherchée.
+ * \return   Un tableau d'objets NombreMagique, éventuellement vide, rangés dans l'ordre d'apparition dans le code.
+ */
+    NombreMagique* getNombresMagiques(Valeur valeur);
+
     /**
  * \brief    Ajoute une information à la liste des informations utilisées par le programme.
+ * \details  L'information est également ajoutée à l'index de chacune des catégories auxquelles elle appartient
+ *           (voir Information::getCategories()).
  * \param[in]  information  L'information à ajouter à la liste des informations utilisées dans le code. \n
  */
     void addInformation (Information* information);
 
     /**
  * \brief    Supprime l'information de la liste des informations utilisées dans le code.
+ * \details  L'information est également retirée de l'index de chacune des catégories auxquelles elle appartient.
  * \param[in]  information  L'information à supprimer de la liste informations utilisées dans le code.
  */
     void removeInformation (Information* information);
 
+    /**
+ * \brief    Identifie les informations du code ayant un type donné.
+ * \details  L'index inverse des types est propre au code (il est stocké dans son arène) : il est tenu à jour
+ *           par Information::setType() sans verrou, même lorsque le type est partagé par tout un projet.
+ * \param[in]  type  Le type recherché.
+ * \return   Un tableau d'objets Information, éventuellement vide, rangés dans l'ordre d'apparition dans le code.
+ */
+    Information* getInformations(Type* type);
+
+    /**
+ * \brief    Met à jour les index par catégorie suite à l'ajout de catégories à une information.
+ * \details  Appelée par Information::ajouterCategories() : l'information est ajoutée à l'index de chaque 
+ *           catégorie présente dans son masque mais absente de anciennesCategories.
+ * \param[in]  information  L'information dont les catégories ont changé.
+ * \param[in]  anciennesCategories  Le masque des catégories de l'information avant la modification.
+ */
+    void reclasserInformation (Information* information, unsigned short int anciennesCategories);
+
 
 
 /**
@@ -177,6 +394,189 @@ public:
     void removeTraitement (Traitement* traitement);
 
 
+/**
+ * \brief    Donne accès au graphe des flux de données du code.
+ * \details  Ce graphe relie chaque Traitement du code aux Information qu'il utilise en donnée 
+ *           ou qu'il produit en résultat. Si le code est en attente d'être figé à nouveau 
+ *           (voir estRefigeageEnAttente()), il est d'abord figé.
+ * \return   L'objet GrapheFluxDeDonnees du code.
+ */
+    GrapheFluxDeDonnees* getGrapheFluxDeDonnees ();
+
+/**
+ * \brief    Donne accès au graphe des accès réellement réalisés par les traitements du code.
+ * \details  Contrairement au graphe des flux de données, alimenté par les contrats des traitements 
+ *           (voir Traitement::getContrat()), ce graphe est construit lors de la décomposition du corps
+ *           des traitements : une information est une donnée d'un traitement si elle y est lue, et un
+ *           résultat si elle y est modifiée. La comparaison des deux graphes permet de repérer les contrats
+ *           incorrects (voir VerificateurContrats). Si le code est en attente d'être figé à nouveau 
+ *           (voir estRefigeageEnAttente()), il est d'abord figé.
+ * \return   L'objet GrapheFluxDeDonnees des accès du code.
+ */
+    GrapheFluxDeDonnees* getGrapheAcces ();
+
+/**
+ * \brief    Indique si un traitement écrit une information à chacune de ses exécutions.
+ * \details  Lors de la décomposition d'un traitement (voir Traitement::decomposer()), la position de chaque 
+ *           écriture est comparée aux étendues des structures de contrôle du traitement : une écriture située
+ *           hors de toute structure conditionnelle ou itérative de ce traitement est certaine. Les arcs
+ *           traitement - résultat certains sont mémorisés par le code, à côté du graphe des accès (voir getGrapheAcces()).
+ * \param[in]  traitement  Le traitement qui écrit l'information.
+ * \param[in]  information  L'information écrite.
+ * \return   \c true si l'une au moins des écritures de l'information par le traitement est certaine, 
+ *           \c false sinon (ou si le traitement n'écrit pas l'information).
+ */
+    bool estEcritureCertaine (Traitement* traitement, Information* information);
+
+/**
+ * \brief    Donne accès à l'arbre de toutes les structures de contrôle du code.
+ * \details  L'arbre est construit lorsque le code est figé (voir figer()). En mode CHARGEMENT_PARESSEUX,
+ *           l'appel à cette méthode décompose tous les traitements non encore décomposés (voir materialiser()),
+ *           puis fige le code à nouveau une seule fois (voir estRefigeageEnAttente()).
+ * \return   L'objet ArbreStructures du code.
+ */
+    ArbreStructures* getArbreStructures ();
+
+/**
+ * \brief    Donne accès à l'arbre des traitements composés et simples du code.
+ * \details  L'arbre est construit lorsque le code est figé, juste après l'arbre des structures de contrôle 
+ *           (voir figer()), à partir de l'index des commentaires (voir getIndexCommentaires()). Si le code est 
+ *           en attente d'être figé à nouveau (voir estRefigeageEnAttente()), il est d'abord figé.
+ * \return   L'objet ArbreTraitements du code.
+ */
+    ArbreTraitements* getArbreTraitements ();
+
+/**
+ * \brief    Fige le code une fois son analyse terminée.
+ * \details  Le graphe des flux de données est converti au format CSR (voir GrapheFluxDeDonnees::figer()). 
+ *           Les informations et les traitements ne sont pas renumérotés : leur numéro leur a été attribué
+ *           à leur construction (voir Information::getNumero() et Traitement::getNumero()), et les arcs déjà
+ *           enregistrés restent donc valides. Les numéros d'objets supprimés deviennent des sommets sans arc. 
+ *           L'arbre des structures de contrôle du code est également construit (voir ArbreStructures),
+ *           puis l'arbre des traitements (voir ArbreTraitements). \n
+ *           Cette méthode est appelée à la fin du constructeur Code(string). Après son appel, le code ne doit
+ *           plus être modifié (ajout / suppression d'informations, de traitements ou de liens donnée / résultat)
+ *           sans avoir été au préalable défigé (voir defiger()). \n
+ *           Les représentations CSR et l'arbre des structures sont reconstruits en totalité à chaque appel : 
+ *           les modifications doivent donc être regroupées entre un appel à defiger() et un seul appel à figer().
+ */
+    void figer ();
+
+/**
+ * \brief    Rend le code à nouveau modifiable.
+ * \details  Les deux graphes sont défigés (voir GrapheFluxDeDonnees::defiger()), et l'arbre des structures
+ *           de contrôle et l'arbre des traitements sont abandonnés. Les numéros des informations et des traitements ne changent pas. 
+ *           Jusqu'à l'appel suivant à figer(), les méthodes donnant accès aux représentations CSR 
+ *           ou à l'arbre des structures ne doivent pas être appelées. \n
+ *           Sans effet si le code n'est pas figé.
+ */
+    void defiger ();
+
+/**
+ * \brief    Indique si le code a été figé.
+ * \return   \c true si le code a été figé, \c false sinon.
+ */
+    bool estFige ();
+
+/**
+ * \brief    Indique si le code a été défigé par une décomposition paresseuse et doit être figé à nouveau.
+ * \details  Traitement::decomposer() défige le code sans le figer à nouveau : la décomposition de plusieurs 
+ *           traitements à la suite ne reconstruit donc les représentations CSR et l'arbre des structures 
+ *           qu'une seule fois, lors du premier accès suivant (getGrapheFluxDeDonnees(), getGrapheAcces(), 
+ *           getArbreStructures(), getArbreTraitements()), qui appelle figer(). Matérialiser tout le code 
+ *           coûte ainsi un temps linéaire.
+ * \return   \c true si le code doit être figé à nouveau avant que ses graphes soient consultés, \c false sinon.
+ */
+    bool estRefigeageEnAttente ();
+
+
+/**
+ * \brief    Met à jour le code suite à une modification de son texte, sans l'analyser à nouveau en totalité.
+ * \details  Seule la zone touchée par la modification est analysée à nouveau. Cette zone correspond au plus petit 
+ *           Traitement (ou, à défaut, à la plus petite StructureDeControle) dont l'étendue (voir EtendueSource) 
+ *           contient entièrement la plage remplacée ; elle est élargie aux Commentaire qui la chevauchent. \n
+ *           Les Information, Traitement, Commentaire et StructureDeControle de cette zone sont mis à jour : 
+ *           un objet dont le texte est toujours présent après modification est conservé (même adresse, 
+ *           même numéro), seuls les objets disparus sont supprimés et les objets apparus créés. 
+ *           Les objets situés hors de la zone ne sont pas touchés, à l'exception de leur étendue qui est décalée 
+ *           si elle se trouve après la plage remplacée. \n
+ *           L'index des commentaires est décalé (voir IndexCommentaires::decaler()) ; si le texte remplacé ou 
+ *           inséré contient un caractère pouvant changer l'état de la lecture des commentaires (délimiteur de 
+ *           commentaire, guillemet, apostrophe, barre oblique inverse ou saut de ligne), les commentaires sont
+ *           extraits à nouveau à partir de la modification (voir IndexCommentaires::reextraire()), et la zone 
+ *           analysée à nouveau est élargie jusqu'au dernier commentaire apparu, disparu ou déplacé. \n
+ *           Si la modification touche des déclarations globales ou la structure d'ensemble du code
+ *           (accolade ouvrante ou fermante non appariée par exemple), le code est analysé à nouveau en totalité.
+ *           Le code est défigé (voir defiger()) avant la mise à jour, puis figé à nouveau une seule fois
+ *           à la fin de celle-ci, quel que soit le nombre d'objets touchés. \n
+ *           Le texte modifié est construit dans un nouveau FichierSource possédant son propre tampon 
+ *           (voir FichierSource::FichierSource(FichierSource*, ModificationTexte)), qui devient le fichier source 
+ *           du code ; c'est sur lui que la zone touchée est analysée et que les commentaires sont extraits à nouveau. 
+ *           Les vues (\c string_view , par exemple Commentaire::getContenuCommentaire()) des objets situés 
+ *           hors de la zone ne sont pas recalculées : elles continuent de désigner le texte de la version 
+ *           précédente, identique au leur. Les versions précédentes du fichier source sont donc conservées 
+ *           (voir versionsPrecedentes), et ne sont libérées que lorsque le code est analysé à nouveau en totalité, 
+ *           toutes les vues désignant alors la version courante.
+ * \param[in]  modification  La modification apportée au texte du code.
+ * \return   \c true si la mise à jour a pu être limitée à la zone touchée, \c false si le code a été 
+ *           analysé à nouveau en totalité.
+ */
+    bool appliquerModification (ModificationTexte modification);
+
+
+/**
+ * \brief    Indique l'empreinte du contenu du fichier source.
+ * \details  L'empreinte est calculée sur les octets du fichier (voir FichierSource) par une fonction de hachage
+ *           non cryptographique sur 128 bits. Deux fichiers de même contenu ont la même empreinte, quel que
+ *           soit leur chemin d'accès.
+ * \return   Une chaîne de 32 caractères hexadécimaux.
+ */
+    string getEmpreinteSource ();
+
+/**
+ * \brief    Écrit l'instantané binaire du code dans un fichier.
+ * \details  Le code doit avoir été figé. L'instantané est composé des sections suivantes :
+ *           - un entête : VERSION_ANALYSEUR, empreinte du fichier source, taille et somme de contrôle de chaque section ;
+ *           - la table locale des noms : les caractères de chaque nom utilisé par le code (informations, 
+ *             traitements, types, littéraux longs, actions des contrats), numérotés de 0 à n-1. Les IdIdentifiant
+ *             du code sont remplacés par ces numéros locaux ;
+ *           - les types : nom local et type des éléments (voir Type::getTypeElement()) de chaque type utilisé ;
+ *           - les objets (Information, Traitement, Commentaire, StructureDeControle), rangés par ordre de création.
+ *             Chaque objet est précédé d'un code désignant sa classe concrète, et ses attributs sont écrits champ
+ *             par champ. Un lien vers un autre objet est écrit sous la forme du rang de cet objet dans la section,
+ *             un Type sous la forme de son rang dans la section des types, une vue sur le fichier source sous la
+ *             forme d'une EtendueSource et une Valeur sous la forme de sa nature suivie de son contenu ;
+ *           - les arcs des deux graphes (voir getGrapheFluxDeDonnees() et getGrapheAcces()), les nœuds de la
+ *             table des expressions et l'index des commentaires, exprimés eux aussi en rangs d'objets.
+ *
+ *           Les arbres (voir getArbreStructures() et getArbreTraitements()) et les représentations CSR ne sont
+ *           pas écrits : ils sont reconstruits lors de la relecture, en temps linéaire.
+ * \param[in]  cheminInstantane  Le chemin d'accès au fichier dans lequel écrire l'instantané.
+ */
+    void enregistrerInstantane (string cheminInstantane);
+
+/**
+ * \brief    Reconstruit un code à partir de son instantané binaire.
+ * \details  Les objets sont reconstruits un à un, dans l'ordre de l'instantané, par leur constructeur : 
+ *           les objets à méthodes virtuelles sont donc valides. Les corrections suivantes sont appliquées :
+ *           - chaque nom de la table locale est interné dans la table des identifiants du code (ou du projet),
+ *             ce qui donne la correspondance entre numéros locaux et IdIdentifiant ;
+ *           - chaque type est recherché (ou créé) dans la table des types du code (ou du projet) ;
+ *           - les rangs d'objets sont remplacés par les IndexNoeud des objets reconstruits, à l'aide d'un 
+ *             tableau de correspondance rempli au fur et à mesure de la reconstruction ;
+ *           - les vues sur le fichier source sont reconstruites à partir de leur étendue, le fichier étant
+ *             à nouveau projeté en mémoire (son empreinte garantit que son contenu n'a pas changé).
+ * \param[in]  cheminInstantane  Le chemin d'accès au fichier contenant l'instantané.
+ * \param[in]  cheminFichier  Le chemin d'accès au fichier source correspondant.
+ * \param[in]  empreinteSource  L'empreinte attendue du fichier source (voir getEmpreinteSource()).
+ * \param[in]  projet  Le projet dont les tables partagées doivent être utilisées, ou la valeur \c null.
+ * \return   Le code reconstruit (figé), ou la valeur \c null si l'instantané est absent, produit par une autre
+ *           version de l'analyseur, ne correspond pas à l'empreinte attendue ou est corrompu.
+ */
+    static Code* chargerInstantane (string cheminInstantane, string cheminFichier, string empreinteSource,
+                                    Projet* projet = null);
+
+
 /**
  * \brief    Identifie le nombre de traitements utilisés dans le code.
   * \param[in]  typeCommentaire  Désigne le type de commentaire à compter. 
@@ -201,7 +601,8 @@ public:
  *             - "information" pour récupérer uniquement les commentaires associés à des informations;\n
  *             - "traitement" pour récupérer uniquement les commentaires associés à des traitements.
  * \return   Un tableau d'objets Commentaire représentant tous les commentaires insérés dans le code. \n
- *           Les commentaires sont ordonnés selon leur ordre d'apparition dans le code.
+ *           Les commentaires sont ordonnés selon leur ordre d'apparition dans le code (ordre de l'index
+ *           des commentaires, voir getIndexCommentaires()).
  *           Le tableau retourné peut être vide si aucun commentaire n'est défini dans le code.
  */
     Commentaire getCommentaires(string typeCommentaire);
@@ -209,16 +610,30 @@ public:
 
     /**
  * \brief    Ajoute un commentaire à la liste des commentaires présents dans le programme.
+ * \details  Le commentaire est inséré dans l'index des commentaires à la place correspondant à son étendue
+ *           (voir IndexCommentaires::inserer()).
  * \param[in]  commentaire  Le commentaire à ajouter à la liste des commentaires présents dans le code.
  */
     void addCommentaire (Commentaire* commentaire);
 
     /**
  * \brief    Supprime le commentaire de la liste des commentaires présents dans le code.
+ * \details  Le commentaire est également retiré de l'index des commentaires (voir IndexCommentaires::retirer()).
  * \param[in]  commentaire  Le commentaire à supprimer de la liste des commentaires présents dans le code.
  */
     void removeCommentaire (Commentaire* commentaire);
 
+
+    /**
+ * \brief    Donne accès à l'index des commentaires du code.
+ * \details  Les commentaires sont extraits en une seule passe (voir ExtracteurCommentaires) et rangés dans 
+ *           l'index par position croissante. Chaque déclaration d'Information ou de Traitement est ensuite
+ *           associée au commentaire qui la précède par une recherche dichotomique dans cet index
+ *           (voir IndexCommentaires::rechercherPrecedent()).
+ * \return   L'objet IndexCommentaires du code.
+ */
+    IndexCommentaires* getIndexCommentaires ();
+
 private:
     /**
     \var string cheminFichier
@@ -228,16 +643,148 @@ private:
     string cheminFichier;
 
     /**
-    \var Information* informations
-    \brief la liste des informations utlisées dans le code source
+    \var FichierSource* fichierSource
+    \brief le fichier contenant le code source, projeté en mémoire
+*/
+    FichierSource* fichierSource;
+
+    /**
+    \var FichierSource** versionsPrecedentes
+    \brief les versions précédentes du fichier source, conservées après chaque modification (voir 
+           appliquerModification()) tant que des vues les désignent encore
+*/
+    FichierSource** versionsPrecedentes;
+
+    /**
+    \var unsigned int nbreVersionsPrecedentes
+    \brief le nombre de versions précédentes du fichier source conservées
+*/
+    unsigned int nbreVersionsPrecedentes;
+
+    /**
+    \var Projet* projet
+    \brief le projet auquel appartient le code, \c null si le code a été chargé seul
+*/
+    Projet* projet;
+
+    /**
+    \var ModeChargement modeChargement
+    \brief la façon dont le code a été chargé
+*/
+    ModeChargement modeChargement;
+
+    /**
+    \var unsigned int nbreTraitementsDecomposes
+    \brief le nombre de traitements dont le corps a déjà été décomposé
+*/
+    unsigned int nbreTraitementsDecomposes;
+
+    /**
+    \var bool refigeageEnAttente
+    \brief indique si le code a été défigé par Traitement::decomposer() et doit être figé à nouveau
+*/
+    bool refigeageEnAttente;
+
+    /**
+    \var ArenaCode* arena
+    \brief l'arène dans laquelle sont alloués tous les objets issus de l'analyse du code
+*/
+    ArenaCode* arena;
+
+    /**
+    \var TableIdentifiants* tableIdentifiants
+    \brief la table des noms utilisés dans le code, propre au code ou partagée par tous les codes du projet
+*/
+    TableIdentifiants* tableIdentifiants;
+
+    /**
+    \var TableTypes* tableTypes
+    \brief la table des types utilisés dans le code, propre au code ou partagée par tous les codes du projet
+*/
+    TableTypes* tableTypes;
+
+    /**
+    \var TableExpressions tableExpressions
+    \brief la table des expressions (conditions notamment) utilisées dans le code
+*/
+    TableExpressions tableExpressions;
+
+    /**
+    \var EvaluateurExpressions* evaluateurExpressions
+    \brief l'évaluateur des expressions du code, créé lors de son premier accès
+*/
+    EvaluateurExpressions* evaluateurExpressions;
+
+    /**
+    \var IndexNoeud informations
+    \brief la liste (stockée dans l'arène) des informations utlisées dans le code source
+*/
+    IndexNoeud informations;
+
+    /**
+    \var IndexNoeud informationsParCategorie[NBRE_CATEGORIES_INFORMATION]
+    \brief pour chaque catégorie élémentaire d'information (voir CategorieInformation), la liste (stockée 
+           dans l'arène) des informations du code appartenant à cette catégorie
+*/
+    IndexNoeud informationsParCategorie[NBRE_CATEGORIES_INFORMATION];
+
+    /**
+    \var IndexNoeud nombresMagiquesParValeur
+    \brief la table de hachage (stockée dans l'arène) regroupant les nombres magiques du code par valeur,
+           construite lors du premier appel à getNombresMagiques() une fois le code matérialisé, et abandonnée
+           lorsqu'un nombre magique est ajouté ou supprimé
+*/
+    IndexNoeud nombresMagiquesParValeur;
+
+    /**
+    \var IndexNoeud informationsParNom
+    \brief la table de hachage (stockée dans l'arène) associant le numéro de chaque nom à la liste des informations
+           portant ce nom, quel que soit le bloc dans lequel elles sont déclarées
+*/
+    IndexNoeud informationsParNom;
+
+    /**
+    \var IndexNoeud informationsParType
+    \brief la table (stockée dans l'arène) associant le numéro de chaque type utilisé à la liste des 
+           informations du code ayant ce type
+*/
+    IndexNoeud informationsParType;
+
+    /**
+    \var IndexNoeud traitements
+    \brief la liste (stockée dans l'arène) des traitements présents dans le code source
+*/
+    IndexNoeud traitements;
+
+    /**
+    \var IndexCommentaires indexCommentaires
+    \brief les commentaires présents dans le code source, rangés par position croissante
+*/
+    IndexCommentaires indexCommentaires;
+
+    /**
+    \var GrapheFluxDeDonnees grapheFluxDeDonnees
+    \brief le graphe reliant les traitements du code aux informations qu'ils utilisent ou produisent
+*/
+    GrapheFluxDeDonnees grapheFluxDeDonnees;
+
+    /**
+    \var GrapheFluxDeDonnees grapheAcces
+    \brief le graphe reliant les traitements du code aux informations qu'ils lisent ou modifient réellement
+*/
+    GrapheFluxDeDonnees grapheAcces;
+
+    /**
+    \var ArbreStructures* arbreStructures
+    \brief l'arbre aplati des structures de contrôle du code, construit lorsque le code est figé
 */
-    Information* informations;
+    ArbreStructures* arbreStructures;
 
     /**
-    \var Traitement* traitements
-    \brief la liste des traitements présents dans le code source
+    \var ArbreTraitements* arbreTraitements
+    \brief l'arbre aplati des traitements du code, construit lors du chargement
 */
-    Information* traitements;
+    ArbreTraitements* arbreTraitements;
 
 };
 #endif
\ No newline at end of file
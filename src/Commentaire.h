@@ -14,6 +14,7 @@
 #include "Information.h"
 #include "Traitement.h"
 #include "Code.h"
+#include "EtendueSource.h"
 
 
 /** 
@@ -34,9 +35,13 @@ public:
 
     /**
  * \brief    Indique le contenu du commentaire.
- * \return   Une chaine de caractères correspondant au contenu du commentaire.
+ * \return   Une vue sur le contenu du commentaire. \n
+ *           Pour un commentaire issu de l'analyse d'un fichier, la vue porte directement sur les octets
+ *           du fichier projeté en mémoire (voir FichierSource) : le contenu n'est jamais recopié. \n
+ *           Pour un commentaire dont le contenu a été défini par setContenuCommentaire(), la vue porte
+ *           sur la table des identifiants du code.
  */
-    String getContenuCommentaire ();
+    string_view getContenuCommentaire ();
 
 
     /**
@@ -109,6 +114,13 @@ public:
     void setTraitement (Traitement* traitement);
 
 
+    /**
+ * \brief    Indique la portion du fichier source à partir de laquelle le commentaire a été construit.
+ * \return   Un objet EtendueSource délimitant le commentaire, délimiteurs compris dans le fichier source.
+ */
+    EtendueSource getEtendue ();
+
+
 private:
     /**
     \var string cheminFichier
@@ -129,5 +141,17 @@ private:
 */
     Traitement* traitements;
 
+    /**
+    \var EtendueSource etendue
+    \brief la portion du fichier source à partir de laquelle le commentaire a été construit.
+*/
+    EtendueSource etendue;
+
+    /**
+    \var string_view contenuCommentaire
+    \brief le contenu du commentaire, vu dans le fichier source projeté en mémoire ou dans la table des identifiants du code.
+*/
+    string_view contenuCommentaire;
+
 };
 #endif
\ No newline at end of file
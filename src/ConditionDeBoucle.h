@@ -0,0 +1,83 @@
+/**
+ * \file      ConditionDeBoucle.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe ConditionDeBoucle.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe ConditionDeBoucle permettant de représenter
+ *             une condition décidant de la poursuite ou de l'arrêt d'une structure itérative.
+ */
+
+#ifndef CONDITION_DE_BOUCLE_H
+#define CONDITION_DE_BOUCLE_H
+
+#include "TableExpressions.h"
+
+/**
+ *  \enum MomentCondition
+ *  \brief Le moment, au sein d'une itération, où une ConditionDeBoucle est évaluée.
+ */
+enum MomentCondition
+{
+    MOMENT_DEBUT,   /**< avant le corps de l'itération ( \c while, \c for, ou \c if \c ... \c break en tête du corps) */
+    MOMENT_MILIEU,  /**< au milieu du corps de l'itération ( \c if \c ... \c break ou \c exit \c when) */
+    MOMENT_FIN      /**< après le corps de l'itération ( \c do \c ... \c while, ou \c if \c ... \c break en fin de corps) */
+};
+
+
+/**
+ *  \class ConditionDeBoucle
+ *  \brief Une classe pour représenter une condition de continuation ou une condition d'arrêt d'une itération.
+ *  \details Une ConditionDeContinuation ( \c while (nbEssais < 10) ) fait poursuivre l'itération tant qu'elle
+ *           est vérifiée ; une ConditionDArret ( \c if (nombre > 0) \c break; ) la fait cesser dès qu'elle l'est.
+ */
+class ConditionDeBoucle
+{
+public:
+/**
+ * \brief    Constructeur : construit une condition de boucle.
+ * \param[in] expression  Le numéro, dans la table des expressions du code, de l'expression booléenne de la condition.
+ * \param[in] estUneConditionDArret  \c true pour une ConditionDArret, \c false pour une ConditionDeContinuation.
+ * \param[in] moment  Le moment où la condition est évaluée au sein de l'itération.
+ */
+    ConditionDeBoucle (IdExpression expression, bool estUneConditionDArret, MomentCondition moment);
+
+
+    /**
+ * \brief    Indique l'expression booléenne de la condition.
+ * \return   Le numéro de l'expression dans la table des expressions du code.
+ */
+    IdExpression getExpression ();
+
+    /**
+ * \brief    Indique si la condition est une condition d'arrêt.
+ * \return   \c true pour une ConditionDArret, \c false pour une ConditionDeContinuation.
+ */
+    bool getEstUneConditionDArret ();
+
+    /**
+ * \brief    Indique le moment où la condition est évaluée au sein de l'itération.
+ * \return   Une valeur de l'énumération MomentCondition.
+ */
+    MomentCondition getMoment ();
+
+
+private:
+    /**
+    \var IdExpression expression
+    \brief le numéro de l'expression booléenne de la condition.
+*/
+    IdExpression expression;
+
+    /**
+    \var bool estUneConditionDArret
+    \brief indique si la condition est une condition d'arrêt (et non de continuation).
+*/
+    bool estUneConditionDArret;
+
+    /**
+    \var MomentCondition moment
+    \brief le moment où la condition est évaluée au sein de l'itération.
+*/
+    MomentCondition moment;
+};
+#endif
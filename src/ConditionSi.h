@@ -0,0 +1,79 @@
+/**
+ * \file      ConditionSi.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe ConditionSi.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe ConditionSi permettant de représenter
+ *             la partie Si d'une structure conditionnelle : une expression booléenne et les traitements
+ *             déclenchés lorsqu'elle est vérifiée.
+ */
+
+#ifndef CONDITION_SI_H
+#define CONDITION_SI_H
+
+#include "TableExpressions.h"
+#include "Traitement.h"
+
+/**
+ *  \class ConditionSi
+ *  \brief Une classe pour représenter la partie Si ( \c if , \c else \c if ...) d'une structure conditionnelle.
+ */
+class ConditionSi
+{
+public:
+/**
+ * \brief    Constructeur : construit une ConditionSi.
+ * \param[in] expression  Le numéro, dans la table des expressions du code (voir Code::getTableExpressions()), 
+ *           de l'expression booléenne de la condition. \n
+ *           Par exemple : l'expression <tt>VAL_ARRET_SAISIE == valeurSaisie</tt>
+ */
+    ConditionSi (IdExpression expression);
+
+
+    /**
+ * \brief    Indique l'expression booléenne de la condition.
+ * \details  Deux conditions ont la même expression si et seulement si elles ont le même numéro d'expression.
+ * \return   Le numéro de l'expression dans la table des expressions du code.
+ */
+    IdExpression getExpression ();
+
+    /**
+ * \brief      Définit l'expression booléenne de la condition.
+ * \param[in]  expression  Le numéro de l'expression dans la table des expressions du code.
+ */
+    void setExpression (IdExpression expression);
+
+
+    /**
+ * \brief    Indique le ou les traitements déclenchés lorsque l'expression de la condition est vérifiée.
+ * \return   Un ensemble d'objets Traitement.
+ */
+    Traitement* getTraitements ();
+
+    /**
+ * \brief    Ajoute un traitement à la liste des traitements déclenchés par la condition.
+ * \param[in]  traitement  Le traitement à ajouter.
+ */
+    void addTraitement (Traitement* traitement);
+
+    /**
+ * \brief    Supprime un traitement de la liste des traitements déclenchés par la condition.
+ * \param[in]  traitement  Le traitement à supprimer.
+ */
+    void removeTraitement (Traitement* traitement);
+
+
+private:
+    /**
+    \var IdExpression expression
+    \brief le numéro de l'expression booléenne de la condition.
+*/
+    IdExpression expression;
+
+    /**
+    \var Traitement* traitements
+    \brief les traitements déclenchés lorsque l'expression est vérifiée.
+*/
+    Traitement* traitements;
+};
+#endif
@@ -0,0 +1,56 @@
+/**
+ * \file      ConditionSinon.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe ConditionSinon.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe ConditionSinon permettant de représenter
+ *             la partie Sinon d'une structure conditionnelle.
+ */
+
+#ifndef CONDITION_SINON_H
+#define CONDITION_SINON_H
+
+#include "Traitement.h"
+
+/**
+ *  \class ConditionSinon
+ *  \brief Une classe pour représenter la partie Sinon ( \c else ) d'une structure conditionnelle.
+ *  \details Une ConditionSinon ne possède pas d'expression propre : elle est vérifiée lorsqu'aucune
+ *           des ConditionSi de la structure ne l'est.
+ */
+class ConditionSinon
+{
+public:
+/**
+ * \brief    Constructeur : construit une ConditionSinon.
+ */
+    ConditionSinon ();
+
+
+    /**
+ * \brief    Indique le ou les traitements déclenchés lorsqu'aucune ConditionSi de la structure n'est vérifiée.
+ * \return   Un ensemble d'objets Traitement.
+ */
+    Traitement* getTraitements ();
+
+    /**
+ * \brief    Ajoute un traitement à la liste des traitements déclenchés par la condition.
+ * \param[in]  traitement  Le traitement à ajouter.
+ */
+    void addTraitement (Traitement* traitement);
+
+    /**
+ * \brief    Supprime un traitement de la liste des traitements déclenchés par la condition.
+ * \param[in]  traitement  Le traitement à supprimer.
+ */
+    void removeTraitement (Traitement* traitement);
+
+
+private:
+    /**
+    \var Traitement* traitements
+    \brief les traitements déclenchés lorsqu'aucune ConditionSi n'est vérifiée.
+*/
+    Traitement* traitements;
+};
+#endif
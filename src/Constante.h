@@ -12,6 +12,7 @@
 #define CONSTANTE_H
 
 #include "Information.h"
+#include "Valeur.h"
 
 
 /** 
@@ -23,29 +24,31 @@ class Constante : public Information
 public:
 /**
  * \brief    Constructeur : construit un objet constante.
- * \param[in] valeur  La valeur de la constante.
+ * \param[in] valeur  La valeur de la constante, de nature VALEUR_AUCUNE si son initialisation n'est pas une 
+ *            expression constante (<tt>const int n = lire();</tt>).
  */
-    Constante (void* valeur);
+    Constante (Valeur valeur);
 
 
     /**
  * \brief    Indique la valeur de la constante.
- * \return   Une valeur correspondant à la valeur de la constante.
+ * \return   Une valeur correspondant à la valeur de la constante, de nature VALEUR_AUCUNE si elle n'est connue
+ *           qu'à l'exécution.
  */
-    void* getValeur ();
+    Valeur getValeur ();
 
 
     /**
  * \brief      Définit la valeur de la constante.
  * \param[in]  valeur  une valeur correspondant à la valeur de la constante.
  */
-    void setValeur (void* valeur);
+    void setValeur (Valeur valeur);
 
 private:
     /**
-    \var void* valeur
-    \brief la valeur de la constante.
+    \var Valeur valeur
+    \brief la valeur de la constante, stockée dans l'objet lui-même.
 */
-    void* valeur;
+    Valeur valeur;
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,184 @@
+/**
+ * \file      ContratTraitement.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe ContratTraitement.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe ContratTraitement permettant de représenter
+ *             le contrat "données >> action >> résultats" écrit en commentaire au-dessus d'un traitement.
+ */
+
+#ifndef CONTRAT_TRAITEMENT_H
+#define CONTRAT_TRAITEMENT_H
+
+#include "TableIdentifiants.h"
+#include "EtendueSource.h"
+
+/**
+ *  \enum NatureElementContrat
+ *  \brief La façon dont un élément est désigné dans la liste des données ou des résultats d'un contrat.
+ */
+enum NatureElementContrat
+{
+    ELEMENT_INFORMATION,  /**< une information désignée par son nom, par exemple : sommeNotes */
+    ELEMENT_MODIFIE,      /**< une information désignée entre crochets, par exemple : [sommeNotes] ; sa signification dépend
+                               du côté du contrat où elle figure (voir VerificateurContrats) */
+    ELEMENT_PERIPHERIQUE  /**< un périphérique extérieur au code, par exemple : (clavier), (ecran) */
+};
+
+
+/**
+ *  \struct ElementContrat
+ *  \brief Un enregistrement décrivant l'un des éléments de la liste des données ou des résultats d'un contrat.
+ */
+struct ElementContrat
+{
+    /**
+    \var IdIdentifiant nom
+    \brief le numéro, dans la table des identifiants du code, du nom de l'élément (sans crochets ni parenthèses).
+*/
+    IdIdentifiant nom;
+
+    /**
+    \var NatureElementContrat nature
+    \brief la façon dont l'élément est désigné.
+*/
+    NatureElementContrat nature;
+};
+
+
+/**
+ *  \class ContratTraitement
+ *  \brief Une classe pour représenter le contrat d'un traitement, écrit en commentaire selon la convention 
+ *         "données >> action >> résultats".
+ *  \details Exemples : \n
+ *           // () >> Saisie, comptage et cumul des notes >> [sommeNotes], [nombreDeNotes] \n
+ *           /&lowast; sommeNotes, nombreDeNotes >> CALCULER LA MOYENNE SI POSSIBLE >> [moyenne] \n
+ *           La liste des données et celle des résultats sont séparées par des virgules ; \c () désigne une liste vide.
+ *           Un contrat ne comportant qu'un seul \c >> n'a pas de liste de données. \n
+ *           La liste des résultats s'arrête à la fin de la première ligne du commentaire : les lignes suivantes,
+ *           en particulier le trait de soulignement ( \c ----- ) d'un commentaire \c /&lowast; , n'en font pas partie. \n
+ *           Un nom cité plusieurs fois dans une même liste (par exemple : <tt>[sommeNotes], [sommeNotes]</tt>) 
+ *           n'y est conservé qu'une seule fois, à sa première position : les données et résultats d'un contrat
+ *           sont donc distincts, et un même lien donnée / résultat n'est jamais ajouté deux fois au graphe des 
+ *           flux de données. Les répétitions sont mémorisées (voir getDoublons()) et signalées par 
+ *           VerificateurContrats. \n
+ *           Les contrats sont reconnus lors de l'extraction des commentaires (voir ExtracteurCommentaires) : 
+ *           analyser() n'examine que le contenu d'un commentaire et ne relit jamais le reste du fichier.
+ */
+class ContratTraitement
+{
+public:
+    /**
+ * \brief    Analyse le contenu d'un commentaire.
+ * \param[in]  contenu  Le contenu du commentaire, sans ses délimiteurs.
+ * \param[in]  table  La table dans laquelle interner l'action et les noms des éléments.
+ * \param[out] contrat  Le contrat reconnu.
+ * \return   \c true si le commentaire suit la convention "données >> action >> résultats", \c false sinon.
+ */
+    static bool analyser (string_view contenu, TableIdentifiants* table, ContratTraitement& contrat);
+
+
+    /**
+ * \brief    Indique l'action décrite par le contrat, qui sert de nom au traitement.
+ * \return   Le numéro de l'action dans la table des identifiants du code. \n
+ *           Par exemple : "Saisie, comptage et cumul des notes"
+ */
+    IdIdentifiant getAction ();
+
+
+    /**
+ * \brief    Indique le nombre de données déclarées par le contrat.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned short int getNbreDonnees ();
+
+    /**
+ * \brief    Donne accès aux données déclarées par le contrat.
+ * \return   Un tableau de getNbreDonnees() éléments, rangés dans l'ordre du commentaire.
+ */
+    ElementContrat* getDonnees ();
+
+
+    /**
+ * \brief    Indique le nombre de résultats déclarés par le contrat.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned short int getNbreResultats ();
+
+    /**
+ * \brief    Donne accès aux résultats déclarés par le contrat.
+ * \return   Un tableau de getNbreResultats() éléments, rangés dans l'ordre du commentaire.
+ */
+    ElementContrat* getResultats ();
+
+
+    /**
+ * \brief    Indique le nombre de noms répétés dans la liste des données ou dans celle des résultats.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned short int getNbreDoublons ();
+
+    /**
+ * \brief    Donne accès aux noms répétés dans la liste des données ou dans celle des résultats.
+ * \return   Un tableau de getNbreDoublons() éléments, un par répétition, rangés dans l'ordre du commentaire.
+ */
+    ElementContrat* getDoublons ();
+
+
+    /**
+ * \brief    Indique la portion du fichier source occupée par le commentaire contenant le contrat.
+ * \return   Un objet EtendueSource délimitant le commentaire, délimiteurs compris.
+ */
+    EtendueSource getEtendue ();
+
+
+private:
+    /**
+    \var IdIdentifiant action
+    \brief l'action décrite par le contrat.
+*/
+    IdIdentifiant action;
+
+    /**
+    \var unsigned short int nbreDonnees
+    \brief le nombre de données déclarées par le contrat.
+*/
+    unsigned short int nbreDonnees;
+
+    /**
+    \var ElementContrat* donnees
+    \brief les données déclarées par le contrat.
+*/
+    ElementContrat* donnees;
+
+    /**
+    \var unsigned short int nbreResultats
+    \brief le nombre de résultats déclarés par le contrat.
+*/
+    unsigned short int nbreResultats;
+
+    /**
+    \var ElementContrat* resultats
+    \brief les résultats déclarés par le contrat.
+*/
+    ElementContrat* resultats;
+
+    /**
+    \var unsigned short int nbreDoublons
+    \brief le nombre de noms répétés dans la liste des données ou dans celle des résultats.
+*/
+    unsigned short int nbreDoublons;
+
+    /**
+    \var ElementContrat* doublons
+    \brief les noms répétés, retirés des données et des résultats.
+*/
+    ElementContrat* doublons;
+
+    /**
+    \var EtendueSource etendue
+    \brief la portion du fichier source occupée par le commentaire contenant le contrat.
+*/
+    EtendueSource etendue;
+};
+#endif
@@ -0,0 +1,71 @@
+/**
+ * \file      EtendueSource.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe EtendueSource.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe EtendueSource permettant de repérer
+ *             la portion d'un fichier source à partir de laquelle un objet a été construit.
+ */
+
+#ifndef ETENDUE_SOURCE_H
+#define ETENDUE_SOURCE_H
+
+/**
+ *  \class EtendueSource
+ *  \brief Une classe pour représenter une plage d'octets [debut ; fin[ au sein d'un fichier source.
+ *  \details Chaque objet issu de l'analyse d'un Code (Information, Traitement, Commentaire, StructureDeControle)
+ *           mémorise l'étendue du texte dont il est issu. C'est à partir de ces étendues que sont retrouvés
+ *           les objets concernés par une modification du texte (voir Code::appliquerModification()).
+ */
+class EtendueSource
+{
+public:
+/**
+ * \brief    Constructeur : construit une étendue à partir de ses bornes.
+ * \param[in] debut  La position (en octets depuis le début du fichier) du premier octet de l'étendue.
+ * \param[in] fin  La position du premier octet situé après l'étendue.
+ */
+    EtendueSource (unsigned long int debut = 0, unsigned long int fin = 0);
+
+
+    /**
+ * \brief    Indique la position du premier octet de l'étendue.
+ * \return   Un entier positif ou nul correspondant à un décalage depuis le début du fichier.
+ */
+    unsigned long int getDebut ();
+
+    /**
+ * \brief    Indique la position du premier octet situé après l'étendue.
+ * \return   Un entier positif ou nul correspondant à un décalage depuis le début du fichier.
+ */
+    unsigned long int getFin ();
+
+
+    /**
+ * \brief    Indique si l'étendue a au moins un octet en commun avec une autre étendue.
+ * \param[in]  autre  L'étendue à comparer.
+ * \return   \c true si les deux étendues se chevauchent, \c false sinon.
+ */
+    bool chevauche (EtendueSource autre);
+
+    /**
+ * \brief    Décale l'étendue suite à l'insertion ou à la suppression de texte située avant elle.
+ * \param[in]  decalage  Le nombre d'octets insérés (valeur positive) ou supprimés (valeur négative).
+ */
+    void decaler (long int decalage);
+
+
+private:
+    /**
+    \var unsigned long int debut
+    \brief la position du premier octet de l'étendue.
+*/
+    unsigned long int debut;
+
+    /**
+    \var unsigned long int fin
+    \brief la position du premier octet situé après l'étendue.
+*/
+    unsigned long int fin;
+};
+#endif
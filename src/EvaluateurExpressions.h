@@ -0,0 +1,111 @@
+/**
+ * \file      EvaluateurExpressions.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe EvaluateurExpressions.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe EvaluateurExpressions permettant de calculer,
+ *             lorsque c'est possible sans exécuter le code, la valeur des expressions d'un code.
+ */
+
+#ifndef EVALUATEUR_EXPRESSIONS_H
+#define EVALUATEUR_EXPRESSIONS_H
+
+#include "TableExpressions.h"
+#include "Valeur.h"
+
+/**
+ *  \enum ResultatEvaluation
+ *  \brief Le résultat de l'évaluation d'une expression booléenne.
+ */
+enum ResultatEvaluation
+{
+    EVALUATION_VRAI,     /**< l'expression est toujours vérifiée */
+    EVALUATION_FAUX,     /**< l'expression n'est jamais vérifiée */
+    EVALUATION_INCONNUE  /**< la valeur de l'expression dépend de l'exécution */
+};
+
+
+/**
+ *  \struct EntreeEvaluation
+ *  \brief Un enregistrement mémorisant le résultat de l'évaluation d'un nœud de la table des expressions.
+ */
+struct EntreeEvaluation
+{
+    /**
+    \var bool estEvaluee
+    \brief indique si le nœud a déjà été évalué.
+*/
+    bool estEvaluee;
+
+    /**
+    \var Valeur valeur
+    \brief la valeur du nœud lorsqu'elle est connue sans exécuter le code, une valeur de nature VALEUR_AUCUNE sinon.
+*/
+    Valeur valeur;
+};
+
+
+/**
+ *  \class EvaluateurExpressions
+ *  \brief Une classe pour évaluer les expressions d'un code dont tous les opérandes sont des constantes.
+ *  \details Une feuille OPERATEUR_LITTERAL a toujours une valeur connue : celle qu'elle porte 
+ *           (voir NoeudExpression::valeur). Une feuille OPERATEUR_INFORMATION a une valeur connue si son 
+ *           information est une Constante ou un NombreMagique (voir Information::getCategories()) dont la Valeur 
+ *           n'est pas de nature VALEUR_AUCUNE : une Constante initialisée par une expression non constante 
+ *           (<tt>const int n = lire();</tt>) a une valeur inconnue. Une variable a toujours une valeur inconnue. \n
+ *           Un opérateur a une valeur connue si tous ses opérandes en ont une ; 
+ *           \c && et \c || ont également une valeur connue dès qu'un opérande suffit à la déterminer. \n
+ *           Le résultat de l'évaluation de chaque nœud est mémorisé dans un tableau indexé par son IdExpression.
+ *           Les sous-expressions étant partagées (voir TableExpressions), chaque nœud n'est évalué qu'une seule
+ *           fois pour tout le code, et le coût total est linéaire en le nombre de nœuds de la table. \n
+ *           La table des expressions peut recevoir de nouveaux nœuds après la construction de l'évaluateur
+ *           (décomposition paresseuse d'un traitement, voir Traitement::decomposer()). Lorsqu'un nœud de numéro 
+ *           supérieur ou égal à nbreEvaluations est demandé, le tableau est agrandi (sa capacité est doublée 
+ *           jusqu'à dépasser TableExpressions::getNbreNoeuds()) et les nouvelles cases sont marquées non évaluées. 
+ *           Les nœuds existants n'étant jamais modifiés, les résultats déjà mémorisés restent valides.
+ */
+class EvaluateurExpressions
+{
+public:
+/**
+ * \brief    Constructeur : construit un évaluateur pour les expressions d'un code.
+ * \param[in] tableExpressions  La table des expressions du code.
+ */
+    EvaluateurExpressions (TableExpressions* tableExpressions);
+
+
+    /**
+ * \brief    Évalue une expression booléenne.
+ * \param[in]  expression  Le numéro de l'expression dans la table des expressions.
+ * \return   Le résultat de l'évaluation.
+ */
+    ResultatEvaluation evaluer (IdExpression expression);
+
+    /**
+ * \brief    Donne le résultat mémorisé de l'évaluation d'un nœud, en l'évaluant si besoin.
+ * \param[in]  expression  Le numéro du nœud dans la table des expressions.
+ * \return   L'enregistrement mémorisant le résultat de l'évaluation du nœud.
+ */
+    const EntreeEvaluation* getEvaluation (IdExpression expression);
+
+
+private:
+    /**
+    \var TableExpressions* tableExpressions
+    \brief la table des expressions évaluées.
+*/
+    TableExpressions* tableExpressions;
+
+    /**
+    \var EntreeEvaluation* evaluations
+    \brief le résultat de l'évaluation de chaque nœud, indexé par son IdExpression.
+*/
+    EntreeEvaluation* evaluations;
+
+    /**
+    \var unsigned int nbreEvaluations
+    \brief le nombre de cases du tableau evaluations.
+*/
+    unsigned int nbreEvaluations;
+};
+#endif
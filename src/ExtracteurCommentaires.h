@@ -0,0 +1,131 @@
+/**
+ * \file      ExtracteurCommentaires.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe ExtracteurCommentaires.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe ExtracteurCommentaires permettant de repérer,
+ *             en une seule lecture d'un fichier source, tous les commentaires qu'il contient.
+ */
+
+#ifndef EXTRACTEUR_COMMENTAIRES_H
+#define EXTRACTEUR_COMMENTAIRES_H
+
+#include "FichierSource.h"
+#include "IndexCommentaires.h"
+
+/**
+ *  \class ExtracteurCommentaires
+ *  \brief Une classe pour repérer les commentaires \c // et \c /&lowast; ... &lowast;/ d'un fichier source.
+ *  \details Le contenu du fichier est parcouru une seule fois, du début vers la fin. Seuls quelques caractères
+ *           peuvent changer l'état de la lecture : \c / (début de commentaire), \c " et \c ' (début de littéral),
+ *           \c \\ (échappement dans un littéral), le saut de ligne (fin d'un commentaire \c //) et les
+ *           accolades (profondeur d'imbrication des blocs). Ces caractères
+ *           sont recherchés 16 ou 32 octets à la fois à l'aide d'instructions SIMD (SSE2 / AVX2 sur x86, 
+ *           NEON sur ARM) : chaque comparaison donne un masque de bits, et les octets ne contenant aucun de ces
+ *           caractères sont franchis sans être examinés un par un. Lorsque ces instructions ne sont pas 
+ *           disponibles, la recherche est réalisée caractère par caractère, avec le même résultat. \n
+ *           Les délimiteurs de commentaire situés dans un littéral (chaîne, caractère ou chaîne brute
+ *           \c R"delim(...)delim") ne sont pas pris en compte. \n
+ *           Une apostrophe n'ouvre un littéral caractère que si elle ne fait pas partie d'un nombre : 
+ *           lorsqu'elle est précédée d'une suite de caractères \c [0-9A-Za-z_.] commençant par un chiffre 
+ *           (ou par un point suivi d'un chiffre), c'est un séparateur de chiffres ( \c 1'000'000 , 
+ *           \c 0xFF'FF ) et elle est ignorée. Une apostrophe précédée d'un préfixe d'encodage 
+ *           ( \c u8'a' , \c L'a' ) ouvre bien un littéral, le préfixe commençant par une lettre. \n
+ *           Chaque commentaire trouvé est ajouté, dans l'ordre du fichier, à un IndexCommentaires : 
+ *           l'extraction et le tri des commentaires ne font donc qu'une seule et même passe. \n
+ *           C'est également au cours de cette passe que les contrats des traitements sont reconnus 
+ *           (voir ContratTraitement::analyser()).
+ */
+class ExtracteurCommentaires
+{
+public:
+/**
+ * \brief    Constructeur : prépare l'extraction des commentaires d'un fichier.
+ * \param[in] fichier  Le fichier source projeté en mémoire.
+ */
+    ExtracteurCommentaires (FichierSource* fichier);
+
+/**
+ * \brief    Constructeur : prépare la reprise de l'extraction à partir d'une position du fichier.
+ * \details  La position doit être située hors de tout commentaire et de tout littéral : c'est le cas de 
+ *           la fin d'un commentaire (voir IndexCommentaires::reextraire()).
+ * \param[in] fichier  Le fichier source projeté en mémoire.
+ * \param[in] positionDepart  La position à partir de laquelle l'extraction reprend.
+ * \param[in] profondeurDepart  Le nombre d'accolades ouvrantes non refermées situées avant cette position.
+ */
+    ExtracteurCommentaires (FichierSource* fichier, unsigned long int positionDepart, unsigned short int profondeurDepart);
+
+
+    /**
+ * \brief    Recherche le prochain commentaire à partir de la position courante.
+ * \param[out] etendue  L'étendue du commentaire trouvé, délimiteurs compris.
+ * \return   \c true si un commentaire a été trouvé, \c false si la fin du fichier a été atteinte.
+ */
+    bool extraireSuivant (EtendueSource& etendue);
+
+    /**
+ * \brief    Indique si le dernier commentaire trouvé par extraireSuivant() est un commentaire \c //.
+ * \return   \c true pour un commentaire \c //, \c false pour un commentaire \c /&lowast; ... &lowast;/.
+ */
+    bool estCommentaireLigne ();
+
+    /**
+ * \brief    Indique la profondeur d'accolades à laquelle se trouve le dernier commentaire trouvé.
+ * \details  Les accolades situées dans un commentaire ou un littéral ne sont pas comptées.
+ * \return   Le nombre d'accolades ouvrantes non refermées situées avant le commentaire.
+ */
+    unsigned short int getProfondeurAccolades ();
+
+    /**
+ * \brief    Indique si le dernier commentaire trouvé est placé seul sur sa ligne.
+ * \return   \c true si seuls des blancs précèdent le commentaire sur sa ligne, \c false sinon.
+ */
+    bool estSeulSurLigne ();
+
+
+    /**
+ * \brief    Indique si le fichier contient un commentaire \c /&lowast; non refermé.
+ * \details  Dans ce cas, le dernier commentaire trouvé s'étend jusqu'à la fin du fichier.
+ * \return   \c true si le dernier commentaire n'est pas refermé, \c false sinon.
+ */
+    bool estCommentaireNonTermine ();
+
+
+private:
+    /**
+    \var FichierSource* fichier
+    \brief le fichier source parcouru.
+*/
+    FichierSource* fichier;
+
+    /**
+    \var unsigned long int position
+    \brief la position à partir de laquelle la recherche reprend.
+*/
+    unsigned long int position;
+
+    /**
+    \var bool commentaireLigne
+    \brief indique si le dernier commentaire trouvé est un commentaire \c //.
+*/
+    bool commentaireLigne;
+
+    /**
+    \var unsigned short int profondeurAccolades
+    \brief le nombre d'accolades ouvrantes non refermées rencontrées jusqu'à la position courante.
+*/
+    unsigned short int profondeurAccolades;
+
+    /**
+    \var bool seulSurLigne
+    \brief indique si le dernier commentaire trouvé est placé seul sur sa ligne.
+*/
+    bool seulSurLigne;
+
+    /**
+    \var bool commentaireNonTermine
+    \brief indique si le dernier commentaire trouvé n'est pas refermé.
+*/
+    bool commentaireNonTermine;
+};
+#endif
@@ -0,0 +1,129 @@
+/**
+ * \file      FichierSource.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe FichierSource.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe FichierSource permettant d'accéder
+ *             au contenu d'un fichier contenant un code source sans en réaliser de copie en mémoire.
+ */
+
+#ifndef FICHIER_SOURCE_H
+#define FICHIER_SOURCE_H
+
+#include "ModificationTexte.h"
+
+/**
+ *  \class FichierSource
+ *  \brief Une classe pour accéder, en lecture seule, au contenu d'un fichier contenant un code source.
+ *  \details Le contenu du fichier est projeté en mémoire (\c mmap sous Linux, \c MapViewOfFile sous Windows) :
+ *           les octets sont lus directement depuis la projection, sans être recopiés au sein d'une chaîne
+ *           de caractères. \n
+ *           Après une modification du texte (voir Code::appliquerModification()), le contenu modifié n'existe
+ *           pas sur le disque : il est placé dans un tampon appartenant à l'objet (voir le second constructeur),
+ *           et les méthodes de lecture s'appliquent indifféremment à une projection ou à un tampon. \n
+ *           Le fichier est parcouru une seule fois, du début vers la fin, à l'aide d'un curseur. Ce mode de
+ *           lecture permet de charger des fichiers de plusieurs dizaines de Mo tout en limitant l'occupation
+ *           mémoire à la taille des objets produits par l'analyse.
+ */
+class FichierSource
+{
+public:
+/**
+ * \brief    Constructeur : projette en mémoire le contenu d'un fichier.
+ * \param[in] cheminFichier  Le chemin d'accès au fichier contenant le code source. \n
+ *           Par exemple : "/home/pierre/prog/helloWorld.php"
+ */
+    FichierSource (string cheminFichier);
+
+/**
+ * \brief    Constructeur : construit le contenu modifié d'un fichier source, dans un tampon possédé par l'objet.
+ * \details  Le tampon est alloué à la taille finale (taille de l'original + décalage de la modification) et 
+ *           rempli en trois copies : le texte situé avant la plage remplacée, le nouveau texte, puis le texte 
+ *           situé après la plage remplacée. L'original n'est pas modifié et reste valide.
+ * \param[in] original  Le fichier source (projeté ou déjà modifié) auquel la modification est appliquée.
+ * \param[in] modification  La modification apportée au texte.
+ */
+    FichierSource (FichierSource* original, ModificationTexte modification);
+
+/**
+ * \brief    Destructeur : libère la projection en mémoire du fichier, ou le tampon contenant le texte modifié.
+ */
+    ~FichierSource ();
+
+
+    /**
+ * \brief    Indique la taille du fichier.
+ * \return   Un entier positif ou nul indiquant le nombre d'octets contenus dans le fichier.
+ */
+    unsigned long int getTaille ();
+
+
+    /**
+ * \brief    Donne accès au contenu du fichier.
+ * \return   L'adresse du premier octet de la projection en mémoire du fichier. \n
+ *           Le contenu n'est pas terminé par un caractère nul : sa longueur est donnée par getTaille().
+ */
+    const char* getContenu ();
+
+
+    /**
+ * \brief    Indique la position courante du curseur de lecture.
+ * \return   Un entier positif ou nul correspondant au décalage (en octets) du curseur depuis le début du fichier.
+ */
+    unsigned long int getPosition ();
+
+
+    /**
+ * \brief    Indique si le curseur de lecture a atteint la fin du fichier.
+ * \return   \c true si tout le contenu du fichier a été parcouru, \c false sinon.
+ */
+    bool estEnFin ();
+
+
+    /**
+ * \brief    Indique l'octet situé sous le curseur sans faire avancer celui-ci.
+ * \return   Le caractère situé à la position courante du curseur.
+ */
+    char consulter ();
+
+
+    /**
+ * \brief    Fait avancer le curseur de lecture.
+ * \details  Le curseur ne peut qu'avancer : le fichier est lu en une seule passe.
+ * \param[in]  nbreOctets  Le nombre d'octets dont le curseur doit avancer.
+ */
+    void avancer (unsigned long int nbreOctets = 1);
+
+
+private:
+    /**
+    \var string cheminFichier
+    \brief le chemin d'accès au fichier projeté en mémoire.
+*/
+    string cheminFichier;
+
+    /**
+    \var const char* contenu
+    \brief l'adresse de la projection en mémoire du fichier, ou du tampon contenant le texte modifié.
+*/
+    const char* contenu;
+
+    /**
+    \var bool estTampon
+    \brief indique si le contenu est un tampon possédé par l'objet (texte modifié) plutôt qu'une projection.
+*/
+    bool estTampon;
+
+    /**
+    \var unsigned long int taille
+    \brief le nombre d'octets contenus dans le fichier.
+*/
+    unsigned long int taille;
+
+    /**
+    \var unsigned long int position
+    \brief la position courante du curseur de lecture.
+*/
+    unsigned long int position;
+};
+#endif
@@ -0,0 +1,176 @@
+/**
+ * \file      GrapheFluxDeDonnees.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe GrapheFluxDeDonnees.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe GrapheFluxDeDonnees permettant de représenter
+ *             les liens donnée / résultat existant entre les Traitement et les Information d'un Code.
+ */
+
+#ifndef GRAPHE_FLUX_DE_DONNEES_H
+#define GRAPHE_FLUX_DE_DONNEES_H
+
+#include "AdjacenceCSR.h"
+
+/**
+ *  \class GrapheFluxDeDonnees
+ *  \brief Une classe pour représenter le graphe biparti reliant les traitements d'un code
+ *         aux informations qu'ils utilisent (données) ou produisent (résultats).
+ *  \details Chaque lien donnée / résultat n'est enregistré qu'une seule fois, dans ce graphe :
+ *           Traitement::addDonnee() et Information::addTraitementEnDonnee() (resp. Traitement::addResultat()
+ *           et Information::addTraitementEnResultat()) ajoutent le même arc. \n
+ *           Pendant l'analyse du code, les arcs sont simplement accumulés. Une fois l'analyse terminée,
+ *           le graphe est figé (voir figer()) : il est alors converti en quatre AdjacenceCSR (données et
+ *           résultats de chaque traitement, consommateurs et producteurs de chaque information) et les
+ *           requêtes de type "tous les producteurs de X" ou "tous les consommateurs de Y" renvoient
+ *           directement une tranche contiguë de l'une de ces représentations. \n
+ *           Les traitements et les informations sont désignés par leur numéro au sein du code
+ *           (voir Traitement::getNumero() et Information::getNumero()), attribué à leur construction.
+ */
+class GrapheFluxDeDonnees
+{
+public:
+/**
+ * \brief    Constructeur : construit un graphe vide, non figé.
+ */
+    GrapheFluxDeDonnees ();
+
+
+    /**
+ * \brief    Enregistre le fait qu'une information joue le rôle de donnée pour un traitement.
+ * \param[in]  traitement  Le numéro du traitement.
+ * \param[in]  information  Le numéro de l'information utilisée en donnée par le traitement.
+ */
+    void addDonnee (unsigned int traitement, unsigned int information);
+
+    /**
+ * \brief    Supprime le fait qu'une information joue le rôle de donnée pour un traitement.
+ * \param[in]  traitement  Le numéro du traitement.
+ * \param[in]  information  Le numéro de l'information utilisée en donnée par le traitement.
+ */
+    void removeDonnee (unsigned int traitement, unsigned int information);
+
+    /**
+ * \brief    Enregistre le fait qu'une information joue le rôle de résultat pour un traitement.
+ * \param[in]  traitement  Le numéro du traitement.
+ * \param[in]  information  Le numéro de l'information produite par le traitement.
+ */
+    void addResultat (unsigned int traitement, unsigned int information);
+
+    /**
+ * \brief    Supprime le fait qu'une information joue le rôle de résultat pour un traitement.
+ * \param[in]  traitement  Le numéro du traitement.
+ * \param[in]  information  Le numéro de l'information produite par le traitement.
+ */
+    void removeResultat (unsigned int traitement, unsigned int information);
+
+
+    /**
+ * \brief    Fige le graphe en construisant ses représentations CSR, en temps linéaire en le nombre d'arcs.
+ * \details  Une fois le graphe figé, les méthodes add...() et remove...() ne doivent plus être appelées
+ *           jusqu'au prochain appel de defiger(). Les arcs accumulés sont conservés.
+ * \param[in]  nbreTraitements  Le nombre de traitements créés dans le code (plus grand numéro + 1).
+ * \param[in]  nbreInformations  Le nombre d'informations créées dans le code (plus grand numéro + 1).
+ */
+    void figer (unsigned int nbreTraitements, unsigned int nbreInformations);
+
+    /**
+ * \brief    Indique si le graphe a été figé.
+ * \return   \c true si le graphe a été figé, \c false sinon.
+ */
+    bool estFige ();
+
+    /**
+ * \brief    Rend le graphe à nouveau modifiable.
+ * \details  Les représentations CSR sont abandonnées ; les arcs accumulés, conservés par figer(), redeviennent 
+ *           la seule représentation du graphe et les méthodes add...() et remove...() peuvent à nouveau être 
+ *           appelées. Plusieurs modifications sont ainsi regroupées entre un appel à defiger() et l'appel 
+ *           suivant à figer(), qui ne reconstruit les représentations CSR qu'une seule fois. \n
+ *           Sans effet si le graphe n'est pas figé.
+ */
+    void defiger ();
+
+
+    /**
+ * \brief    Donne accès aux données d'un traitement (graphe figé uniquement).
+ * \return   Une AdjacenceCSR associant à chaque traitement les numéros des informations qu'il utilise en donnée.
+ */
+    AdjacenceCSR* getDonnees ();
+
+    /**
+ * \brief    Donne accès aux résultats d'un traitement (graphe figé uniquement).
+ * \return   Une AdjacenceCSR associant à chaque traitement les numéros des informations qu'il produit.
+ */
+    AdjacenceCSR* getResultats ();
+
+    /**
+ * \brief    Donne accès aux consommateurs d'une information (graphe figé uniquement).
+ * \return   Une AdjacenceCSR associant à chaque information les numéros des traitements qui l'utilisent en donnée.
+ */
+    AdjacenceCSR* getConsommateurs ();
+
+    /**
+ * \brief    Donne accès aux producteurs d'une information (graphe figé uniquement).
+ * \return   Une AdjacenceCSR associant à chaque information les numéros des traitements qui la produisent.
+ */
+    AdjacenceCSR* getProducteurs ();
+
+
+private:
+    /**
+    \var bool fige
+    \brief indique si le graphe a été figé.
+*/
+    bool fige;
+
+    /**
+    \var unsigned int nbreArcsDonnee
+    \brief le nombre d'arcs traitement - donnée enregistrés.
+*/
+    unsigned int nbreArcsDonnee;
+
+    /**
+    \var unsigned int* arcsDonnee
+    \brief les arcs traitement - donnée enregistrés, conservés lorsque le graphe est figé
+           (numéro du traitement et numéro de l'information, rangés l'un après l'autre).
+*/
+    unsigned int* arcsDonnee;
+
+    /**
+    \var unsigned int nbreArcsResultat
+    \brief le nombre d'arcs traitement - résultat enregistrés.
+*/
+    unsigned int nbreArcsResultat;
+
+    /**
+    \var unsigned int* arcsResultat
+    \brief les arcs traitement - résultat enregistrés, conservés lorsque le graphe est figé
+           (numéro du traitement et numéro de l'information, rangés l'un après l'autre).
+*/
+    unsigned int* arcsResultat;
+
+    /**
+    \var AdjacenceCSR* donnees
+    \brief pour chaque traitement, les informations qu'il utilise en donnée.
+*/
+    AdjacenceCSR* donnees;
+
+    /**
+    \var AdjacenceCSR* resultats
+    \brief pour chaque traitement, les informations qu'il produit.
+*/
+    AdjacenceCSR* resultats;
+
+    /**
+    \var AdjacenceCSR* consommateurs
+    \brief pour chaque information, les traitements qui l'utilisent en donnée (transposée de donnees).
+*/
+    AdjacenceCSR* consommateurs;
+
+    /**
+    \var AdjacenceCSR* producteurs
+    \brief pour chaque information, les traitements qui la produisent (transposée de resultats).
+*/
+    AdjacenceCSR* producteurs;
+};
+#endif
@@ -0,0 +1,172 @@
+/**
+ * \file      IndexCommentaires.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe IndexCommentaires.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe IndexCommentaires permettant de retrouver
+ *             rapidement les commentaires d'un code à partir d'une position dans le fichier source.
+ */
+
+#ifndef INDEX_COMMENTAIRES_H
+#define INDEX_COMMENTAIRES_H
+
+#include "ArenaCode.h"
+#include "EtendueSource.h"
+#include "FichierSource.h"
+
+/**
+ *  \class IndexCommentaires
+ *  \brief Une classe pour ranger les étendues des commentaires d'un code par position croissante.
+ *  \details Les commentaires d'un fichier ne se chevauchent jamais : triés selon leur début, ils sont aussi
+ *           triés selon leur fin. L'index se compose donc de deux tableaux parallèles (débuts et fins des
+ *           étendues) et du tableau des commentaires correspondants (IndexNoeud dans l'arène du code). \n
+ *           Les commentaires étant extraits dans l'ordre du fichier (voir ExtracteurCommentaires), 
+ *           ajouter() ne fait qu'écrire à la fin de ces tableaux ; les recherches sont des recherches 
+ *           dichotomiques, en temps logarithmique en le nombre de commentaires. \n
+ *           Un commentaire ajouté ou supprimé après l'extraction (voir Code::addCommentaire() et 
+ *           Code::removeCommentaire()) est rangé à sa place par inserer() ou retiré par retirer(), 
+ *           qui décalent les éléments suivants en temps linéaire. \n
+ *           La profondeur d'accolades de chaque commentaire (voir ExtracteurCommentaires::getProfondeurAccolades())
+ *           est conservée : la fin d'un commentaire est toujours située hors de tout littéral, et l'extraction
+ *           peut donc reprendre à cette position après une modification du texte (voir reextraire()).
+ */
+class IndexCommentaires
+{
+public:
+/**
+ * \brief    Constructeur : construit un index vide.
+ */
+    IndexCommentaires ();
+
+
+    /**
+ * \brief    Ajoute un commentaire à la fin de l'index.
+ * \details  L'étendue du commentaire doit commencer après la fin du dernier commentaire ajouté.
+ * \param[in]  etendue  L'étendue du commentaire dans le fichier source, délimiteurs compris.
+ * \param[in]  commentaire  L'index du Commentaire dans l'arène du code.
+ * \param[in]  profondeurAccolades  Le nombre d'accolades ouvrantes non refermées situées avant le commentaire.
+ */
+    void ajouter (EtendueSource etendue, IndexNoeud commentaire, unsigned short int profondeurAccolades);
+
+    /**
+ * \brief    Insère un commentaire dans l'index, à la place correspondant à son étendue.
+ * \details  La place est trouvée par recherche dichotomique ; les commentaires suivants sont décalés d'une case.
+ *           L'étendue ne doit chevaucher aucun commentaire de l'index.
+ * \param[in]  etendue  L'étendue du commentaire dans le fichier source, délimiteurs compris.
+ * \param[in]  commentaire  L'index du Commentaire dans l'arène du code.
+ * \param[in]  profondeurAccolades  Le nombre d'accolades ouvrantes non refermées situées avant le commentaire.
+ */
+    void inserer (EtendueSource etendue, IndexNoeud commentaire, unsigned short int profondeurAccolades);
+
+    /**
+ * \brief    Retire un commentaire de l'index.
+ * \details  Le commentaire est retrouvé par recherche dichotomique sur le début de son étendue ; 
+ *           les commentaires suivants sont décalés d'une case. Sans effet si l'étendue ne correspond
+ *           à aucun commentaire de l'index.
+ * \param[in]  etendue  L'étendue du commentaire à retirer.
+ */
+    void retirer (EtendueSource etendue);
+
+
+    /**
+ * \brief    Indique le nombre de commentaires rangés dans l'index.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned int getNbreCommentaires ();
+
+    /**
+ * \brief    Donne accès aux commentaires de l'index.
+ * \return   Un tableau de getNbreCommentaires() index de Commentaire, rangés dans l'ordre du fichier source.
+ */
+    const IndexNoeud* getCommentaires ();
+
+    /**
+ * \brief    Indique la profondeur d'accolades d'un commentaire de l'index.
+ * \param[in]  rang  La position du commentaire dans getCommentaires().
+ * \return   Le nombre d'accolades ouvrantes non refermées situées avant le commentaire.
+ */
+    unsigned short int getProfondeurAccolades (unsigned int rang);
+
+
+    /**
+ * \brief    Recherche le commentaire contenant une position du fichier source.
+ * \param[in]  position  La position recherchée, en octets depuis le début du fichier.
+ * \return   L'index du Commentaire dont l'étendue contient la position, ou INDEX_NUL si la position 
+ *           n'est située dans aucun commentaire.
+ */
+    IndexNoeud rechercher (unsigned long int position);
+
+    /**
+ * \brief    Recherche le dernier commentaire terminé avant une position du fichier source.
+ * \details  C'est cette recherche qui permet d'associer une déclaration (d'Information ou de Traitement)
+ *           au commentaire qui la précède : l'analyse vérifie ensuite que seuls des blancs séparent 
+ *           la fin du commentaire trouvé du début de la déclaration.
+ * \param[in]  position  La position du début de la déclaration, en octets depuis le début du fichier.
+ * \return   La position, dans getCommentaires(), du dernier commentaire se terminant au plus tard à 
+ *           la position donnée, ou getNbreCommentaires() s'il n'en existe aucun.
+ */
+    unsigned int rechercherPrecedent (unsigned long int position);
+
+
+    /**
+ * \brief    Décale les commentaires situés après une modification du texte (voir Code::appliquerModification()).
+ * \details  Ne convient que si ni le texte remplacé ni le texte inséré ne contiennent de caractère pouvant changer
+ *           l'état de la lecture (voir ExtracteurCommentaires) ; sinon, reextraire() doit être utilisée.
+ * \param[in]  position  La position à partir de laquelle les commentaires sont décalés.
+ * \param[in]  decalage  Le nombre d'octets insérés (valeur positive) ou supprimés (valeur négative).
+ */
+    void decaler (unsigned long int position, long int decalage);
+
+    /**
+ * \brief    Met à jour l'index après une modification du texte pouvant créer, supprimer ou déplacer des commentaires.
+ * \details  Une modification insérant ou supprimant \c /&lowast; , &lowast;/ , \c // , un guillemet, une apostrophe,
+ *           une barre oblique inverse ou un saut de ligne peut changer la nature de tout le texte qui la suit. 
+ *           Les commentaires commençant à partir de la fin du dernier commentaire terminé avant la modification 
+ *           (voir rechercherPrecedent()) sont retirés de l'index, puis l'extraction reprend à cette position, 
+ *           avec la profondeur d'accolades de ce commentaire (voir ExtracteurCommentaires::ExtracteurCommentaires()).
+ *           Après la plage modifiée, l'extraction s'arrête dès qu'un commentaire trouvé coïncide, une fois décalé, 
+ *           avec un commentaire retiré : la suite du fichier est alors inchangée, et les commentaires restants 
+ *           sont simplement décalés et remis dans l'index. \n
+ *           Les commentaires apparus ou disparus sont signalés au code (voir Code::addCommentaire() et 
+ *           Code::removeCommentaire()).
+ * \param[in]  fichier  Le fichier source après modification, dont le contenu est un tampon possédé par l'objet 
+ *             (voir FichierSource::FichierSource(FichierSource*, ModificationTexte)).
+ * \param[in]  debut  La position du début de la plage remplacée.
+ * \param[in]  finAncienne  La position de la fin de la plage remplacée, avant modification.
+ * \param[in]  decalage  Le nombre d'octets insérés (valeur positive) ou supprimés (valeur négative).
+ */
+    void reextraire (FichierSource* fichier, unsigned long int debut, unsigned long int finAncienne, long int decalage);
+
+
+private:
+    /**
+    \var unsigned int nbreCommentaires
+    \brief le nombre de commentaires rangés dans l'index.
+*/
+    unsigned int nbreCommentaires;
+
+    /**
+    \var unsigned long int* debuts
+    \brief la position du premier octet de chaque commentaire, par ordre croissant.
+*/
+    unsigned long int* debuts;
+
+    /**
+    \var unsigned long int* fins
+    \brief la position du premier octet situé après chaque commentaire, par ordre croissant.
+*/
+    unsigned long int* fins;
+
+    /**
+    \var IndexNoeud* commentaires
+    \brief les commentaires correspondants, dans l'arène du code.
+*/
+    IndexNoeud* commentaires;
+
+    /**
+    \var unsigned short int* profondeurs
+    \brief la profondeur d'accolades de chaque commentaire.
+*/
+    unsigned short int* profondeurs;
+};
+#endif
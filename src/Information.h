@@ -15,6 +15,35 @@
 #include "Traitement.h"
 #include "Type.h"
 #include "Commentaire.h"
+#include "ArenaCode.h"
+#include "EtendueSource.h"
+#include "TableIdentifiants.h"
+#include "ClassifieurConventionNommage.h"
+
+/**
+ *  \enum CategorieInformation
+ *  \brief Les catégories auxquelles une information peut appartenir.
+ *  \details Les valeurs sont des puissances de 2 : elles peuvent être combinées à l'aide de l'opérateur \c |
+ *           pour désigner plusieurs catégories à la fois. Une même information appartient généralement
+ *           à plusieurs catégories (un compteur est aussi une variable simple et une variable).
+ */
+enum CategorieInformation
+{
+    CATEGORIE_CONSTANTE           = 1 << 0, /**< équivalent de "const" */
+    CATEGORIE_NOMBRE_MAGIQUE      = 1 << 1, /**< équivalent de "magic" */
+    CATEGORIE_VARIABLE            = 1 << 2, /**< équivalent de "var" */
+    CATEGORIE_VARIABLE_SIMPLE     = 1 << 3, /**< équivalent de "simpleVar" */
+    CATEGORIE_VARIABLE_STRUCTUREE = 1 << 4, /**< équivalent de "composedVar" */
+    CATEGORIE_ACCUMULATEUR        = 1 << 5, /**< équivalent de "accu" */
+    CATEGORIE_COMPTEUR            = 1 << 6, /**< équivalent de "count" */
+    CATEGORIE_INDICE_DE_BOUCLE    = 1 << 7, /**< équivalent de "index" */
+    CATEGORIE_TOUTES              = (1 << 8) - 1 /**< équivalent de "all" */
+};
+
+/**
+ * \brief    Nombre de catégories élémentaires d'information (CATEGORIE_TOUTES exclue).
+ */
+const unsigned short int NBRE_CATEGORIES_INFORMATION = 8;
 
 /** 
  *  \class Information
@@ -25,16 +54,18 @@ class Information
 {
 public:
     /**
- * \brief    Constructeur : construit un objet Information à partir de son nom
- *           et de sa convention de nommage
- * \param[in] nom  Le nom de l'information. \n
+ * \brief    Constructeur : construit un objet Information à partir de son nom.
+ * \details  La convention de nommage de l'information n'est pas connue à sa construction : elle est 
+ *           calculée par lots, une fois toutes les informations du code construites, par 
+ *           ClassifieurConventionNommage::classer() (voir setConventionNommage()).
+ * \param[in] nom  Une vue sur le nom de l'information, par exemple dans le fichier source projeté en mémoire. \n
+ *           Le nom est interné dans la table des identifiants du code (voir Code::getTableIdentifiants()) : 
+ *           la vue n'a pas besoin de rester valide après la construction. \n
  *           Par exemple : "perimètre"
- * \param[in] conventionNommage  La convention de nommage utilisée pour nommer l'information. \n
- *           Par exemple : "camelCase"
- * \param[in] code  Le code dans lequel l'information est utilisée.
- *          
+ * \param[in] code  Le code dans lequel l'information est utilisée. \n
+ *           L'information est allouée dans l'arène de ce code (voir Code::getArena()).
  */
-    Information (String nom, String conventionNommage, Code* code);
+    Information (string_view nom, Code* code);
 
 
     /**
@@ -54,32 +85,51 @@ public:
 
     /**
  * \brief    Indique le nom de l'information.
- * \return   Une chaine de caractères correspondant au nom de l'information
- *           ou la valeur \c null si l'information ne possède pas de nom 
+ * \return   Une vue sur le nom de l'information, stocké une seule fois dans la table des identifiants du code
+ *           (voir Code::getTableIdentifiants()), ou une vue vide si l'information ne possède pas de nom 
  *           (cas d'un nombre magique par exemple)
  */
-    String getNom ();
+    string_view getNom ();
+
+    /**
+ * \brief    Indique le numéro du nom de l'information dans la table des identifiants du code.
+ * \details  Deux informations portent le même nom si et seulement si elles ont le même numéro de nom.
+ * \return   Le numéro du nom de l'information.
+ */
+    IdIdentifiant getIdNom ();
 
 
     /**
  * \brief      Définit le nom de l'information.
- * \param[in]  nom  Le nom de l'information sous forme de chaîne de caractères. \n
+ * \details    Le nom est interné dans la table des identifiants du code (voir Code::getTableIdentifiants()).
+ * \param[in]  nom  Une vue sur le nom de l'information. \n
  */
-    void setNom (string nom);
+    void setNom (string_view nom);
+
 
+    /**
+ * \brief    Indique la convention de nommage utilisée pour nommer l'information.
+ * \return   Une vue sur la chaine de caractères correspondant à la convention de nommage utilisée pour nommer l'information
+ *           (voir ClassifieurConventionNommage::getNom()).
+ */
+    string_view getConventionNommage ();
 
     /**
  * \brief    Indique la convention de nommage utilisée pour nommer l'information.
- * \return   Une chaine de caractères correspondant à la convention de nommage utilisée pour nommer l'information.
+ * \details  La convention de nommage n'est pas déterminée information par information : elle est calculée
+ *           par lots, pour les noms des seules informations du code, par 
+ *           ClassifieurConventionNommage::classer(TableIdentifiants*, const IdIdentifiant*, unsigned int, ConventionNommage*).
+ * \return   Une valeur de l'énumération ConventionNommage.
  */
-    String getConventionNommage ();
+    ConventionNommage getCodeConventionNommage ();
 
 
     /**
  * \brief      Définit la convention de nommage utilisée pour nommer l'information.
+ * \details    Appelée avec le résultat de ClassifieurConventionNommage::classer() pour le nom de l'information.
  * \param[in]  convention  La convention de nommage utilisée pour nommer l'information. \n
  */
-    void setConventionNommage (string convention);
+    void setConventionNommage (ConventionNommage convention);
 
 
     /**
@@ -91,6 +141,8 @@ public:
 
     /**
  * \brief    Définit le type d'une information.
+ * \details  L'index inverse des types de son code est mis à jour : l'information est retirée de la liste 
+ *           de son ancien type et ajoutée à celle du nouveau (voir Code::getInformations(Type*)).
  * \param[in]  type  Le type de l'information. \n
  */
     void setType (Type* type);
@@ -115,12 +167,16 @@ public:
     /**
  * \brief    Indique le ou les traitements pour lesquels l'information joue le rôle de donnée.
  * \return   Un ensemble d'objets Traitement pour lesquels l'information joue le rôle de donnée.
- *           Si aucun traitement n'utilise cette information en tant que donnée, la valeur \c null est retournée.
+ *           Si aucun traitement n'utilise cette information en tant que donnée, la valeur \c null est retournée. \n
+ *           Ces traitements sont les consommateurs de l'information dans le graphe des flux de données du code 
+ *           (voir GrapheFluxDeDonnees::getConsommateurs()).
  */
     Traitement* getTraitementsEnDonnee ();
 
     /**
  * \brief    Ajoute un traitement à la liste des traitements qui utilisent l'information en donnée.
+ * \details  Équivaut à l'appel traitementIn->addDonnee(this) : le lien n'est enregistré qu'une seule fois,
+ *           dans le graphe des flux de données du code.
  * \param[in]  traitementIn  Le traitement à ajouter à a liste des traitements qui utilisent l'information en donnée. \n
  */
     void addTraitementEnDonnee (Traitement* traitementIn);
@@ -135,12 +191,16 @@ public:
     /**
  * \brief    Indique le ou les traitements pour lesquels l'information joue le rôle de résultat.
  * \return   Un ensemble d'objets Traitement pour lesquels l'information joue le rôle de résultat.
- *           Si aucun traitement ne produit cette information en tant que résultat, la valeur \c null est retournée.
+ *           Si aucun traitement ne produit cette information en tant que résultat, la valeur \c null est retournée. \n
+ *           Ces traitements sont les producteurs de l'information dans le graphe des flux de données du code 
+ *           (voir GrapheFluxDeDonnees::getProducteurs()).
  */
     Traitement* getTraitementsEnResultat ();
 
     /**
  * \brief    Ajoute un traitement à la liste des traitements qui utilisent l'information en résultat.
+ * \details  Équivaut à l'appel traitementOut->addResultat(this) : le lien n'est enregistré qu'une seule fois,
+ *           dans le graphe des flux de données du code.
  * \param[in]  traitementOut  Le traitement à ajouter à la liste des traitements qui utilisent l'information en résultat. \n
  */
     void addTraitementEnResultat (Traitement* traitementOut);
@@ -208,6 +268,52 @@ public:
     bool estUnIndiceDeBoucle ();
 
 
+    /**
+ * \brief    Indique toutes les catégories auxquelles appartient l'information.
+ * \details  Les catégories liées à la déclaration (CATEGORIE_CONSTANTE à CATEGORIE_VARIABLE_STRUCTUREE) sont 
+ *           déterminées à la construction de l'information. Les catégories liées au rôle de l'information
+ *           (CATEGORIE_ACCUMULATEUR, CATEGORIE_COMPTEUR, CATEGORIE_INDICE_DE_BOUCLE) ne sont connues qu'après 
+ *           la décomposition des traitements qui l'utilisent : elles sont ajoutées par ajouterCategories(). \n
+ *           Les méthodes estUne...() et estUn...() se contentent de consulter le masque ainsi calculé.
+ * \return   Une combinaison (via l'opérateur \c |) de valeurs de l'énumération CategorieInformation.
+ */
+    unsigned short int getCategories ();
+
+    /**
+ * \brief    Ajoute des catégories à celles de l'information.
+ * \details  Appelée lors de la décomposition d'un traitement (voir Traitement::decomposer()) lorsque le rôle 
+ *           de l'information y est reconnu. Les index par catégorie du code sont mis à jour en conséquence
+ *           (voir Code::reclasserInformation()) : l'information est ajoutée à l'index de chaque catégorie nouvelle.
+ * \param[in]  categories  Une combinaison (via l'opérateur \c |) de valeurs de l'énumération CategorieInformation.
+ */
+    void ajouterCategories (unsigned short int categories);
+
+
+    /**
+ * \brief    Indique le numéro de l'information au sein du code.
+ * \details  Le numéro est attribué à la construction de l'information (compteur d'informations du code) et
+ *           ne change plus : les liens donnée / résultat peuvent donc être enregistrés avant que le code soit figé.
+ *           Le numéro d'une information supprimée n'est pas réattribué.
+ * \return   Un entier compris entre 0 et le nombre d'informations créées dans le code - 1, 
+ *           utilisé pour désigner l'information dans le graphe des flux de données du code.
+ */
+    unsigned int getNumero ();
+
+
+    /**
+ * \brief    Indique la portion du fichier source à partir de laquelle l'information a été construite.
+ * \return   Un objet EtendueSource délimitant la déclaration de l'information dans le fichier source.
+ */
+    EtendueSource getEtendue ();
+
+    /**
+ * \brief    Indique la portion du fichier source dans laquelle l'information est visible.
+ * \return   Un objet EtendueSource délimitant le bloc (accolades comprises) dans lequel l'information 
+ *           est déclarée, ou tout le fichier pour une information globale.
+ */
+    EtendueSource getPortee ();
+
+
 protected:
 
     /**
@@ -217,51 +323,59 @@ protected:
     Code* code;
 
     /**
- *   \var string nom
- *   \brief Le nom de l'information.  
+ *   \var IdIdentifiant nom
+ *   \brief Le numéro, dans la table des identifiants du code, du nom de l'information.  
  */
-    string nom;
+    IdIdentifiant nom;
 
     /**
- *   \var string conventionNommage
- *   \brief La convention de nommage utilisée pour nommer l'information. \n
- *   \details Cet attribut peut prendre une des valeurs suivantes : \n
-      - "camelCase", \n
-      - "pascalCase", \n
-      - "snakeCase", \n
-      - "kebabCase", \n
-      - "undefinedStyle" si la convention de nommage ne correspond à aucun des styles précédents.\n \n
-      Pour plus d’infos sur les 4 premiers styles : \n
-      <https://medium.com/better-programming/string-case-styles-camel-pascal-snake-and-kebab-case-981407998841>
+ *   \var ConventionNommage conventionNommage
+ *   \brief La convention de nommage utilisée pour nommer l'information (voir l'énumération ConventionNommage).
  */
-    string conventionNommage;
+    ConventionNommage conventionNommage;
 
 
     /**
  *   \var Type* type
- *   \brief Le type de l'information.
+ *   \brief Le type de l'information, obtenu auprès de la table des types du code (voir Code::getTableTypes()).
  */
     Type* type;
 
 
     /**
- *   \var Commentaire* commentaire
- *   \brief Le commentaire éventuel attaché à la variable lors de sa déclaration.
+ *   \var IndexNoeud commentaire
+ *   \brief L'index, dans l'arène du code, du commentaire éventuel attaché à la variable lors de sa déclaration 
+ *          (INDEX_NUL si aucun commentaire n'est attaché à la variable).
  */
-    Commentaire* commentaire;
+    IndexNoeud commentaire;
 
 
     /**
- *   \var Traitement* enDonneeDe
- *   \brief Le ou les traitements pour lesquels l'information joue le rôle de donnée.
+ *   \var unsigned int numero
+ *   \brief Le numéro de l'information au sein du code. \n
+ *   \details Les traitements pour lesquels l'information joue le rôle de donnée ou de résultat ne sont pas
+ *            mémorisés par l'information : ils sont retrouvés, à partir de ce numéro, dans le graphe 
+ *            des flux de données du code (voir Code::getGrapheFluxDeDonnees()).
+ */
+    unsigned int numero;
+
+    /**
+ *   \var unsigned short int categories
+ *   \brief Le masque des catégories (CategorieInformation) auxquelles appartient l'information.
+ */
+    unsigned short int categories;
+
+    /**
+ *   \var EtendueSource etendue
+ *   \brief La portion du fichier source à partir de laquelle l'information a été construite.
  */
-    Traitement* enDonneeDe;
+    EtendueSource etendue;
 
     /**
- *   \var Traitement* enResultatDe
- *   \brief Le ou les traitements pour lesquels l'information joue le rôle de résultat.
+ *   \var EtendueSource portee
+ *   \brief La portion du fichier source dans laquelle l'information est visible.
  */
-    Traitement* enResultatDe;
+    EtendueSource portee;
 
 };
 #endif
\ No newline at end of file
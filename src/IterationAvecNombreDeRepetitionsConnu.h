@@ -0,0 +1,149 @@
+/**
+ * \file      IterationAvecNombreDeRepetitionsConnu.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe IterationAvecNombreDeRepetitionsConnu.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe IterationAvecNombreDeRepetitionsConnu permettant
+ *             de représenter des structures itératives de type \c for , \c foreach ou assimilé.
+ */
+
+#ifndef ITERATION_AVEC_NOMBRE_DE_REPETITIONS_CONNU_H
+#define ITERATION_AVEC_NOMBRE_DE_REPETITIONS_CONNU_H
+
+#include "StructureIterative.h"
+#include "VariableSimple.h"
+#include "VariableStructuree.h"
+
+/** 
+ *  \class IterationAvecNombreDeRepetitionsConnu
+ *  \brief Une classe pour représenter les itérations exécutant un ou plusieurs traitements un nombre de fois connu.
+ *  \details Exemple : <tt>for (int i = 0; i < nbreNotes; i++)</tt> a pour IndiceDeBoucle \c i , 
+ *           pour borne de départ \c 0 , pour borne d'arrivée \c nbreNotes (exclue) et pour pas \c 1 . \n
+ *           <tt>for (int i = 1; i < n; i *= 2)</tt> a pour pas \c 2 et un pas multiplicatif.
+ */
+class IterationAvecNombreDeRepetitionsConnu : public StructureIterative
+{
+public:
+/**
+ * \brief    Constructeur : construit une itération avec nombre de répétitions connu.
+ * \details  L'itération est de nature NATURE_ITERATIVE_NBRE_REPET_CONNU.
+ * \param[in] indiceDeBoucle  L'IndiceDeBoucle de l'itération, \c null s'il n'y en a pas ( \c foreach , \c PERFORM \c N \c TIMES ).
+ * \param[in] borneDepart  L'expression de la borne de départ (EXPRESSION_NULLE s'il n'y en a pas).
+ * \param[in] borneArrivee  L'expression de la borne d'arrivée, ou du nombre de répétitions.
+ * \param[in] borneArriveeIncluse  \c true si la borne d'arrivée est atteinte lors de la dernière itération 
+ *            ( \c i \c <= \c n , \c i \c >= \c 0 ), \c false sinon ( \c i \c < \c n ).
+ * \param[in] pas  L'expression du pas de progression de l'indice (EXPRESSION_NULLE s'il n'y en a pas).
+ * \param[in] pasMultiplicatif  \c true si l'indice progresse par multiplication ou division par le pas 
+ *            ( \c i \c *= \c 2 , \c i \c = \c i \c / \c 2 ), \c false s'il progresse par addition ou soustraction.
+ * \param[in] estCroissante  \c true si l'indice progresse de manière croissante ( \c i++ , \c i \c *= \c 2 ), 
+ *            \c false s'il progresse de manière décroissante ( \c i-- , \c i \c /= \c 2 ).
+ * \param[in] collectionParcourue  La VariableStructuree parcourue ( \c foreach , ou \c for dont la borne d'arrivée 
+ *            est la taille d'une collection), \c null s'il n'y en a pas.
+ */
+    IterationAvecNombreDeRepetitionsConnu (VariableSimple* indiceDeBoucle, IdExpression borneDepart,
+                                           IdExpression borneArrivee, bool borneArriveeIncluse,
+                                           IdExpression pas, bool pasMultiplicatif, bool estCroissante,
+                                           VariableStructuree* collectionParcourue = null);
+
+
+    /**
+ * \brief    Indique l'IndiceDeBoucle de l'itération.
+ * \return   Une VariableSimple jouant le rôle d'IndiceDeBoucle, ou la valeur \c null.
+ */
+    VariableSimple* getIndiceDeBoucle ();
+
+    /**
+ * \brief    Indique la borne de départ de l'itération.
+ * \return   Le numéro de l'expression de la borne de départ dans la table des expressions du code.
+ */
+    IdExpression getBorneDepart ();
+
+    /**
+ * \brief    Indique la borne d'arrivée de l'itération.
+ * \return   Le numéro de l'expression de la borne d'arrivée dans la table des expressions du code.
+ */
+    IdExpression getBorneArrivee ();
+
+    /**
+ * \brief    Indique si la borne d'arrivée est atteinte lors de la dernière itération ( \c <= ) ou non ( \c < ).
+ * \return   \c true si la borne d'arrivée est incluse, \c false sinon.
+ */
+    bool getBorneArriveeIncluse ();
+
+    /**
+ * \brief    Indique le pas de progression de l'IndiceDeBoucle.
+ * \return   Le numéro de l'expression du pas dans la table des expressions du code.
+ */
+    IdExpression getPas ();
+
+    /**
+ * \brief    Indique si l'IndiceDeBoucle progresse par multiplication ou division par le pas.
+ * \return   \c true pour un pas multiplicatif ( \c i \c *= \c 2 ), \c false pour un pas additif ( \c i \c += \c 2 ).
+ */
+    bool getPasMultiplicatif ();
+
+    /**
+ * \brief    Indique si l'IndiceDeBoucle progresse de manière croissante.
+ * \return   \c true pour une boucle croissante, \c false pour une boucle décroissante.
+ */
+    bool getEstCroissante ();
+
+
+    /**
+ * \brief    Indique la collection parcourue par l'itération ( \c foreach , ou \c for dont la borne d'arrivée 
+ *           est la taille d'une collection).
+ * \return   La VariableStructuree parcourue, ou la valeur \c null.
+ */
+    VariableStructuree* getCollectionParcourue ();
+
+
+private:
+    /**
+    \var VariableSimple* indiceDeBoucle
+    \brief l'IndiceDeBoucle de l'itération.
+*/
+    VariableSimple* indiceDeBoucle;
+
+    /**
+    \var IdExpression borneDepart
+    \brief l'expression de la borne de départ.
+*/
+    IdExpression borneDepart;
+
+    /**
+    \var IdExpression borneArrivee
+    \brief l'expression de la borne d'arrivée.
+*/
+    IdExpression borneArrivee;
+
+    /**
+    \var bool borneArriveeIncluse
+    \brief indique si la borne d'arrivée est atteinte lors de la dernière itération.
+*/
+    bool borneArriveeIncluse;
+
+    /**
+    \var IdExpression pas
+    \brief l'expression du pas de progression de l'indice.
+*/
+    IdExpression pas;
+
+    /**
+    \var bool pasMultiplicatif
+    \brief indique si l'indice progresse par multiplication ou division par le pas.
+*/
+    bool pasMultiplicatif;
+
+    /**
+    \var bool estCroissante
+    \brief indique si l'indice progresse de manière croissante.
+*/
+    bool estCroissante;
+
+    /**
+    \var VariableStructuree* collectionParcourue
+    \brief la collection parcourue par l'itération, \c null s'il n'y en a pas.
+*/
+    VariableStructuree* collectionParcourue;
+};
+#endif
@@ -0,0 +1,49 @@
+/**
+ * \file      IterationAvecNombreDeRepetitionsInconnu.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe IterationAvecNombreDeRepetitionsInconnu.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe IterationAvecNombreDeRepetitionsInconnu permettant
+ *             de représenter des structures itératives de type \c while , \c do \c while , \c for \c ( \c ; \c ; \c ) ou assimilé.
+ */
+
+#ifndef ITERATION_AVEC_NOMBRE_DE_REPETITIONS_INCONNU_H
+#define ITERATION_AVEC_NOMBRE_DE_REPETITIONS_INCONNU_H
+
+#include "StructureIterative.h"
+
+/** 
+ *  \class IterationAvecNombreDeRepetitionsInconnu
+ *  \brief Une classe pour représenter les itérations dont le nombre de répétitions dépend d'une ou plusieurs ConditionDeBoucle.
+ *  \details Les quatre familles d'itérations décrites dans la modélisation (IterationAvecConditionAuDebut, 
+ *           IterationAvecConditionALaFin, IterationAvecConditionAuMilieu et IterationAvecConditionsADifferentsMoments)
+ *           ne se distinguent que par le moment où sont évaluées leurs conditions de boucle. Elles sont représentées
+ *           par cette seule classe, leur famille étant donnée par la nature de la structure 
+ *           (NATURE_ITERATIVE_COND_AU_DEBUT, NATURE_ITERATIVE_COND_A_LA_FIN, NATURE_ITERATIVE_COND_AU_MILIEU
+ *           ou NATURE_ITERATIVE_COND_MULTIPLES), déduite des moments des ConditionDeBoucle. \n
+ *           Exemple : dans mainProf.cpp, la boucle <tt>for ( ; ; )</tt> contenant 
+ *           <tt>if (VAL_ARRET_SAISIE == valeurSaisie) break;</tt> après la saisie est une itération avec 
+ *           une ConditionDArret évaluée au milieu (NATURE_ITERATIVE_COND_AU_MILIEU).
+ */
+class IterationAvecNombreDeRepetitionsInconnu : public StructureIterative
+{
+public:
+/**
+ * \brief    Constructeur : construit une itération avec nombre de répétitions inconnu.
+ * \details  La nature transmise (NATURE_ITERATIVE_COND_AU_DEBUT, NATURE_ITERATIVE_COND_A_LA_FIN, 
+ *           NATURE_ITERATIVE_COND_AU_MILIEU ou NATURE_ITERATIVE_COND_MULTIPLES) est déduite des moments 
+ *           des conditions de boucle.
+ * \param[in] conditionsDeBoucle  Les conditions de continuation ou d'arrêt de l'itération, dans leur ordre d'évaluation.
+ * \param[in] nbreConditionsDeBoucle  Le nombre de conditions de boucle (au moins 1).
+ */
+    IterationAvecNombreDeRepetitionsInconnu (ConditionDeBoucle* conditionsDeBoucle, unsigned int nbreConditionsDeBoucle);
+
+
+    /**
+ * \brief    Indique le moment où sont évaluées les conditions de boucle.
+ * \return   Le moment commun à toutes les conditions de boucle. \n
+ *           Pour une itération de nature NATURE_ITERATIVE_COND_MULTIPLES, le moment de la première condition évaluée.
+ */
+    MomentCondition getMoment ();
+};
+#endif
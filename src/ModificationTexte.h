@@ -0,0 +1,64 @@
+/**
+ * \file      ModificationTexte.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe ModificationTexte.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe ModificationTexte permettant de représenter
+ *             une modification apportée au texte d'un code source déjà analysé (par un éditeur par exemple).
+ */
+
+#ifndef MODIFICATION_TEXTE_H
+#define MODIFICATION_TEXTE_H
+
+#include "EtendueSource.h"
+
+/**
+ *  \class ModificationTexte
+ *  \brief Une classe pour représenter le remplacement d'une plage d'octets d'un code source par un nouveau texte.
+ *  \details Une insertion correspond à une étendue vide, une suppression à un nouveau texte vide.
+ */
+class ModificationTexte
+{
+public:
+/**
+ * \brief    Constructeur : construit une modification de texte.
+ * \param[in] etendueRemplacee  La plage d'octets remplacée, exprimée dans le texte AVANT modification.
+ * \param[in] nouveauTexte  Le texte qui remplace la plage d'octets. \n
+ *           Par exemple : "sommeNotes = 0;"
+ */
+    ModificationTexte (EtendueSource etendueRemplacee, string nouveauTexte);
+
+
+    /**
+ * \brief    Indique la plage d'octets remplacée.
+ * \return   Une étendue exprimée dans le texte avant modification.
+ */
+    EtendueSource getEtendueRemplacee ();
+
+    /**
+ * \brief    Indique le texte qui remplace la plage d'octets.
+ * \return   Une chaîne de caractères, éventuellement vide.
+ */
+    string getNouveauTexte ();
+
+    /**
+ * \brief    Indique de combien d'octets la modification décale le texte situé après la plage remplacée.
+ * \return   La différence entre la longueur du nouveau texte et celle de la plage remplacée.
+ */
+    long int getDecalage ();
+
+
+private:
+    /**
+    \var EtendueSource etendueRemplacee
+    \brief la plage d'octets remplacée, exprimée dans le texte avant modification.
+*/
+    EtendueSource etendueRemplacee;
+
+    /**
+    \var string nouveauTexte
+    \brief le texte qui remplace la plage d'octets.
+*/
+    string nouveauTexte;
+};
+#endif
@@ -0,0 +1,58 @@
+/**
+ * \file      MoteurMetriques.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les méthodes d'une classe MoteurMetriques.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe MoteurMetriques permettant de calculer
+ *             les métriques de complexité des traitements d'un code ou d'un projet.
+ */
+
+#ifndef MOTEUR_METRIQUES_H
+#define MOTEUR_METRIQUES_H
+
+#include "Code.h"
+#include "Projet.h"
+#include "TableMetriques.h"
+
+/**
+ *  \class MoteurMetriques
+ *  \brief Une classe pour calculer la complexité cyclomatique, la profondeur d'imbrication et le nombre
+ *         de branches de chaque traitement.
+ *  \details Les métriques sont calculées en un seul parcours de l'arbre aplati des structures de contrôle
+ *           (voir ArbreStructures) : chaque nœud ajoute sa contribution aux métriques du traitement qui le 
+ *           contient (NoeudArbreStructures::traitement), ou à la ligne HORS_TRAITEMENTS du code s'il n'est contenu
+ *           dans aucun traitement, selon sa nature :
+ *           - StructureSi, StructureSiSinon : 1 point de décision ;
+ *           - StructureSiSi, StructureSiSiSinon : 1 point de décision par ConditionSi ;
+ *           - StructureSwitch : 1 point de décision par cas ;
+ *           - structure itérative : 1 point de décision.
+ *
+ *           Les nœuds sont répartis entre plusieurs fils d'exécution par tranches contiguës du tableau de
+ *           nœuds ; chaque fil cumule ses résultats dans ses propres compteurs. À la fin, les points de décision
+ *           et les nombres de branches et d'itérations des différents fils sont additionnés, tandis que les 
+ *           profondeurs maximales d'imbrication sont combinées en prenant leur maximum.
+ *           Pour un projet, les codes sont eux-mêmes répartis entre les fils d'exécution.
+ */
+class MoteurMetriques
+{
+public:
+    /**
+ * \brief    Calcule les métriques de chacun des traitements d'un code.
+ * \param[in]  code  Le code (figé) à analyser.
+ * \param[in]  nbreFilsExecution  Le nombre de fils d'exécution à utiliser (0 pour le nombre de cœurs disponibles).
+ * \return   Une table comportant une ligne par traitement du code, rangées selon le numéro des traitements,
+ *           suivies d'une ligne HORS_TRAITEMENTS pour les structures de contrôle situées hors de tout traitement.
+ */
+    static TableMetriques* calculer (Code* code, unsigned short int nbreFilsExecution = 0);
+
+    /**
+ * \brief    Calcule les métriques de chacun des traitements de tous les codes d'un projet.
+ * \param[in]  projet  Le projet à analyser.
+ * \param[in]  nbreFilsExecution  Le nombre de fils d'exécution à utiliser (0 pour le nombre de cœurs disponibles).
+ * \return   Une table comportant une ligne par traitement, rangées code par code puis selon le numéro des traitements
+ *           (chaque code se terminant par sa ligne HORS_TRAITEMENTS). \n
+ *           Les métriques par code sont obtenues par TableMetriques::agregerParCode().
+ */
+    static TableMetriques* calculer (Projet* projet, unsigned short int nbreFilsExecution = 0);
+};
+#endif
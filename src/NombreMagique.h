@@ -12,6 +12,7 @@
 #define NOMBRE_MAGIQUE_H
 
 #include "Information.h"
+#include "Valeur.h"
 
 
 /** 
@@ -25,27 +26,27 @@ public:
  * \brief    Constructeur : construit un objet nombre magique.
  * \param[in] valeur  La valeur du nombre magique.
  */
-    NombreMagique (void* valeur);
+    NombreMagique (Valeur valeur);
 
 
     /**
  * \brief    Indique la valeur du nombre magique.
  * \return   La valeur du nombre magique.
  */
-    void* getValeur ();
+    Valeur getValeur ();
 
 
     /**
  * \brief      Définit la valeur du nombre magique.
  * \param[in]  valeur  La valeur du nombre magique.
  */
-    void setValeur (void* valeur);
+    void setValeur (Valeur valeur);
 
 private:
     /**
-    \var void* valeur
-    \brief la valeur du nombre magique.
+    \var Valeur valeur
+    \brief la valeur du nombre magique, stockée dans l'objet lui-même.
 */
-    void* valeur;
+    Valeur valeur;
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,212 @@
+/**
+ * \file      OrdonnancementTraitements.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe OrdonnancementTraitements.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe OrdonnancementTraitements permettant de
+ *             repérer les traitements d'un code qui pourraient s'exécuter simultanément.
+ */
+
+#ifndef ORDONNANCEMENT_TRAITEMENTS_H
+#define ORDONNANCEMENT_TRAITEMENTS_H
+
+#include "Code.h"
+#include "AdjacenceCSR.h"
+#include "AnalyseDefinitions.h"
+
+/**
+ *  \class OrdonnancementTraitements
+ *  \brief Une classe pour ordonner les traitements d'un code selon leurs dépendances et mesurer leur chemin critique.
+ *  \details Les sommets du graphe des dépendances sont, soit les traitements simples (feuilles de l'arbre des 
+ *           traitements, voir ArbreTraitements) de tout le code, soit les sous-traitements directs d'un même 
+ *           traitement composé : un sommet n'est donc jamais contenu dans un autre. Les accès d'un sommet composé
+ *           sont ceux de ses feuilles. Les sommets sont rangés dans l'ordre de l'arbre des traitements, 
+ *           c'est-à-dire dans l'ordre du fichier, et désignés par leur rang dans cet ordre (voir getSommets()). \n
+ *           Les arcs ne traduisent que les dépendances de données entre un sommet \c u et un sommet \c v 
+ *           rangé après lui, et non le simple ordre d'écriture (liens Traitement::sontApres) :
+ *           - lecture après écriture : une écriture de \c u atteint une lecture de \c v 
+ *             (chaînes définition - utilisation, voir AnalyseDefinitions::getUtilisations()) ;
+ *           - écriture après lecture : \c u lit une information que \c v écrit (graphe des accès, voir 
+ *             Code::getGrapheAcces()) ;
+ *           - écriture après écriture : \c u et \c v écrivent la même information ;
+ *           - ordre des entrées / sorties : \c u et \c v désignent le même ELEMENT_PERIPHERIQUE dans leur contrat 
+ *             ( \c (clavier) , \c (ecran) ...), les échanges avec un périphérique devant garder leur ordre.
+ *
+ *           Les trois derniers types d'arcs sont obtenus en un seul parcours des sommets dans l'ordre, en mémorisant,
+ *           pour chaque information, son dernier sommet écrivain et les sommets l'ayant lue depuis, et pour chaque
+ *           périphérique, son dernier sommet utilisateur. Seuls les arcs allant vers un sommet de rang supérieur 
+ *           étant conservés (les autres correspondent à un retour de boucle), le graphe obtenu est sans circuit. 
+ *           Il est rangé dans une AdjacenceCSR, avec sa transposée. \n
+ *           L'ordre topologique est calculé par l'algorithme de Kahn (file des sommets sans prédécesseur 
+ *           restant) ; le niveau d'un sommet est la longueur du plus long chemin qui l'atteint, calculée 
+ *           au cours du même parcours. Les traitements d'un même niveau ne dépendent pas les uns des autres :
+ *           ils pourraient s'exécuter simultanément. Les niveaux sont rangés les uns à la suite des autres,
+ *           comme les listes d'une AdjacenceCSR. \n
+ *           Le chemin critique est le plus long chemin du graphe, chaque sommet ayant un poids de 1. Le chemin
+ *           critique d'un traitement composé est celui du graphe de ses sous-traitements directs : il est obtenu
+ *           en construisant un ordonnancement pour ce traitement. \n
+ *           Un second parcours, en ordre topologique inverse, donne pour chaque sommet la longueur du plus
+ *           long chemin qui en part ; la somme des deux longueurs donne le plus long chemin passant par lui. \n
+ *           Tous ces calculs sont linéaires en le nombre de sommets + le nombre d'accès + le nombre d'arcs.
+ */
+class OrdonnancementTraitements
+{
+public:
+/**
+ * \brief    Constructeur : ordonne les traitements d'un code.
+ * \param[in] code  Le code (figé) dont les traitements doivent être ordonnés.
+ * \param[in] definitions  Les chaînes définition - utilisation du code. \n
+ *           La valeur \c null indique qu'elles doivent être calculées (voir AnalyseDefinitions).
+ * \param[in] compose  Le traitement composé dont les sous-traitements directs doivent être ordonnés. \n
+ *           La valeur \c null indique que les traitements simples de tout le code doivent être ordonnés.
+ */
+    OrdonnancementTraitements (Code* code, AnalyseDefinitions* definitions = null, Traitement* compose = null);
+
+
+    /**
+ * \brief    Indique le nombre de sommets du graphe des dépendances.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned int getNbreSommets ();
+
+    /**
+ * \brief    Identifie les sommets du graphe des dépendances.
+ * \return   Un tableau de getNbreSommets() numéros de traitements (voir Traitement::getNumero()), 
+ *           rangés dans l'ordre de l'arbre des traitements ; le rang d'un traitement dans ce tableau 
+ *           le désigne dans les autres méthodes.
+ */
+    const unsigned int* getSommets ();
+
+
+    /**
+ * \brief    Donne accès au graphe des dépendances entre traitements.
+ * \return   Une AdjacenceCSR associant au rang de chaque sommet les rangs des sommets qui dépendent de lui.
+ */
+    AdjacenceCSR* getDependances ();
+
+
+    /**
+ * \brief    Donne l'ordre topologique des traitements.
+ * \return   Un tableau de getNbreSommets() rangs de sommets, un sommet étant toujours rangé 
+ *           après ceux dont il dépend.
+ */
+    const unsigned int* getOrdreTopologique ();
+
+
+    /**
+ * \brief    Indique le nombre de niveaux du graphe des dépendances.
+ * \return   Un entier positif ou nul, égal à la longueur du chemin critique (0 s'il n'y a aucun sommet).
+ */
+    unsigned int getNbreNiveaux ();
+
+    /**
+ * \brief    Indique le nombre de traitements d'un niveau.
+ * \param[in]  niveau  Le numéro du niveau, compris entre 0 et getNbreNiveaux() - 1.
+ * \return   Un entier strictement positif.
+ */
+    unsigned int getNbreTraitementsNiveau (unsigned int niveau);
+
+    /**
+ * \brief    Identifie les traitements d'un niveau, qui pourraient s'exécuter simultanément.
+ * \param[in]  niveau  Le numéro du niveau, compris entre 0 et getNbreNiveaux() - 1.
+ * \return   Un tableau contigu de getNbreTraitementsNiveau(niveau) rangs de sommets.
+ */
+    const unsigned int* getTraitementsNiveau (unsigned int niveau);
+
+    /**
+ * \brief    Indique le niveau d'un traitement.
+ * \param[in]  traitement  Le traitement concerné, qui doit être l'un des sommets.
+ * \return   Le numéro du niveau, égal à la longueur du plus long chemin atteignant le traitement.
+ */
+    unsigned int getNiveau (Traitement* traitement);
+
+
+    /**
+ * \brief    Indique la longueur du chemin critique des sommets ordonnés (du code, ou du traitement composé 
+ *           passé au constructeur).
+ * \return   Le nombre de sommets du plus long chemin du graphe des dépendances (0 s'il n'y a aucun sommet).
+ */
+    unsigned int getLongueurCheminCritique ();
+
+    /**
+ * \brief    Indique la longueur du plus long chemin passant par un sommet.
+ * \param[in]  traitement  Le traitement concerné, qui doit être l'un des sommets.
+ * \return   Un entier strictement positif ; le traitement est sur un chemin critique si cette valeur 
+ *           est égale à getLongueurCheminCritique().
+ */
+    unsigned int getLongueurCheminPassantPar (Traitement* traitement);
+
+    /**
+ * \brief    Indique la marge d'un traitement.
+ * \param[in]  traitement  Le traitement concerné, qui doit être l'un des sommets.
+ * \return   Le nombre de niveaux dont l'exécution du traitement peut être retardée sans allonger le chemin 
+ *           critique (0 pour un traitement situé sur un chemin critique).
+ */
+    unsigned int getMarge (Traitement* traitement);
+
+
+    /**
+ * \brief    Indique le parallélisme potentiel du code.
+ * \return   Le rapport entre le nombre de sommets et la longueur du chemin critique (1 pour un code
+ *           entièrement séquentiel), ou 0 s'il n'y a aucun sommet.
+ */
+    double getParallelisme ();
+
+
+private:
+    /**
+    \var unsigned int nbreSommets
+    \brief le nombre de sommets du graphe des dépendances.
+*/
+    unsigned int nbreSommets;
+
+    /**
+    \var unsigned int* sommets
+    \brief les numéros des traitements ordonnés, rangés dans l'ordre de l'arbre des traitements.
+*/
+    unsigned int* sommets;
+
+    /**
+    \var AdjacenceCSR* dependances
+    \brief pour chaque sommet, les sommets qui dépendent de lui.
+*/
+    AdjacenceCSR* dependances;
+
+    /**
+    \var unsigned int* ordreTopologique
+    \brief les rangs des sommets, rangés en ordre topologique.
+*/
+    unsigned int* ordreTopologique;
+
+    /**
+    \var unsigned int nbreNiveaux
+    \brief le nombre de niveaux du graphe des dépendances.
+*/
+    unsigned int nbreNiveaux;
+
+    /**
+    \var unsigned int* debutsNiveaux
+    \brief pour chaque niveau, la position de son premier traitement dans traitementsParNiveau 
+           (nbreNiveaux + 1 cases).
+*/
+    unsigned int* debutsNiveaux;
+
+    /**
+    \var unsigned int* traitementsParNiveau
+    \brief les rangs des sommets, rangés niveau par niveau.
+*/
+    unsigned int* traitementsParNiveau;
+
+    /**
+    \var unsigned int* niveaux
+    \brief pour chaque sommet, la longueur du plus long chemin qui l'atteint.
+*/
+    unsigned int* niveaux;
+
+    /**
+    \var unsigned int* longueursRestantes
+    \brief pour chaque sommet, la longueur du plus long chemin qui en part, sommet compris.
+*/
+    unsigned int* longueursRestantes;
+};
+#endif
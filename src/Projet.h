@@ -0,0 +1,156 @@
+/**
+ * \file      Projet.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe Projet.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe Projet permettant d'analyser
+ *             en une seule fois l'ensemble des fichiers source d'un projet (un dépôt, un répertoire...).
+ */
+
+#ifndef PROJET_H
+#define PROJET_H
+
+#include "Code.h"
+#include "TableTypes.h"
+#include "Librairie.h"
+#include "CacheAnalyse.h"
+#include "TableIdentifiants.h"
+
+/**
+ *  \class Projet
+ *  \brief Une classe pour représenter un ensemble de codes source analysés ensemble.
+ *  \details Un Projet produit un objet Code par fichier analysé. Les fichiers sont répartis entre
+ *           plusieurs fils d'exécution (threads) : chaque fil dispose de sa propre file de fichiers
+ *           à analyser et, lorsqu'elle est vide, vole des fichiers dans la file d'un autre fil
+ *           (répartition par vol de tâches, ou \e work-stealing). \n
+ *           Les objets Type et Librairie sont partagés par tous les Code du projet : un type ou une
+ *           librairie utilisé dans plusieurs fichiers n'est représenté que par un seul objet.
+ */
+class Projet
+{
+public:
+/**
+ * \brief    Constructeur : analyse tous les fichiers source contenus dans un répertoire.
+ * \details  Le répertoire est parcouru récursivement.
+ * \param[in] cheminRepertoire  Le chemin d'accès au répertoire contenant les fichiers à analyser. \n
+ *           Par exemple : "/home/pierre/prog/"
+ * \param[in] nbreFilsExecution  Le nombre de fils d'exécution utilisés pour analyser les fichiers. \n
+ *           La valeur 0 correspond au nombre de cœurs disponibles sur la machine.
+ * \param[in] cache  Le cache dans lequel rechercher (et enregistrer) les codes analysés. \n
+ *           La valeur \c null indique que tous les fichiers doivent être analysés.
+ */
+    Projet (string cheminRepertoire, unsigned short int nbreFilsExecution = 0, CacheAnalyse* cache = null);
+
+/**
+ * \brief    Constructeur : analyse une liste de fichiers source.
+ * \param[in] cheminsFichiers  Les chemins d'accès aux fichiers à analyser.
+ * \param[in] nbreFichiers  Le nombre de fichiers à analyser.
+ * \param[in] nbreFilsExecution  Le nombre de fils d'exécution utilisés pour analyser les fichiers. \n
+ *           La valeur 0 correspond au nombre de cœurs disponibles sur la machine.
+ * \param[in] cache  Le cache dans lequel rechercher (et enregistrer) les codes analysés. \n
+ *           La valeur \c null indique que tous les fichiers doivent être analysés.
+ */
+    Projet (string* cheminsFichiers, unsigned int nbreFichiers, unsigned short int nbreFilsExecution = 0,
+            CacheAnalyse* cache = null);
+
+
+    /**
+ * \brief    Indique le nombre de fils d'exécution utilisés pour analyser les fichiers du projet.
+ * \return   Un entier strictement positif correspondant au nombre de fils d'exécution.
+ */
+    unsigned short int getNbreFilsExecution ();
+
+
+    /**
+ * \brief    Indique le nombre de codes analysés dans le projet.
+ * \return   Un entier positif ou nul correspondant au nombre de fichiers analysés.
+ */
+    unsigned int getNbreCodes ();
+
+    /**
+ * \brief    Identifie les codes analysés dans le projet.
+ * \return   Un tableau d'objets Code, à raison d'un objet par fichier analysé. \n
+ *           Les codes sont ordonnés selon l'ordre des fichiers fournis (ou rencontrés lors du parcours du répertoire),
+ *           quel que soit l'ordre dans lequel les fils d'exécution les ont analysés.
+ */
+    Code* getCodes ();
+
+
+    /**
+ * \brief    Indique le nombre de types utilisés dans l'ensemble des codes du projet.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned int getNbreTypes ();
+
+    /**
+ * \brief    Identifie l'un des types utilisés dans l'ensemble des codes du projet.
+ * \param[in]  numero  Le numéro du type, compris entre 0 et getNbreTypes() - 1.
+ * \return   L'objet Type partagé par tous les codes du projet (voir TableTypes::getTypeParNumero()).
+ */
+    Type* getType (unsigned int numero);
+
+    /**
+ * \brief    Donne accès à la table des types partagée par tous les codes du projet.
+ * \details  Comme pour la table des identifiants, chaque fil d'exécution consulte d'abord son cache local
+ *           (voir TableTypes::CacheLocal) et ne verrouille la table partagée que pour les types qu'il 
+ *           rencontre pour la première fois.
+ * \return   L'objet TableTypes du projet.
+ */
+    TableTypes* getTableTypes ();
+
+
+    /**
+ * \brief    Identifie les librairies utilisées dans l'ensemble des codes du projet.
+ * \return   Un tableau d'objets Librairie partagés par tous les codes du projet.
+ */
+    Librairie* getLibrairies ();
+
+
+    /**
+ * \brief    Donne accès à la table des noms partagée par tous les codes du projet.
+ * \details  La table est remplie simultanément par plusieurs fils d'exécution : chaque fil commence par
+ *           rechercher un nom dans son cache local (voir TableIdentifiants::CacheLocal), puis ne consulte 
+ *           la table partagée (protégée par un verrou) que pour les noms qu'il rencontre pour la première fois.
+ * \return   L'objet TableIdentifiants du projet.
+ */
+    TableIdentifiants* getTableIdentifiants ();
+
+
+private:
+    /**
+    \var unsigned short int nbreFilsExecution
+    \brief le nombre de fils d'exécution utilisés pour analyser les fichiers.
+*/
+    unsigned short int nbreFilsExecution;
+
+    /**
+    \var unsigned int nbreCodes
+    \brief le nombre de codes analysés dans le projet.
+*/
+    unsigned int nbreCodes;
+
+    /**
+    \var Code* codes
+    \brief les codes analysés, à raison d'un code par fichier.
+*/
+    Code* codes;
+
+    /**
+    \var TableTypes tableTypes
+    \brief le registre des types partagé par tous les codes du projet.
+*/
+    TableTypes tableTypes;
+
+    /**
+    \var Librairie* librairies
+    \brief le registre des librairies partagé par tous les codes du projet.
+*/
+    Librairie* librairies;
+
+    /**
+    \var TableIdentifiants tableIdentifiants
+    \brief la table des noms partagée par tous les codes du projet.
+*/
+    TableIdentifiants tableIdentifiants;
+};
+#endif
@@ -26,5 +26,11 @@ public:
   virtual ~StructureConditionnelle() = 0;
  
 protected:
+/**
+ * \brief    Constructeur : construit une structure conditionnelle d'une nature donnée.
+ * \param[in] nature  La nature de la structure (NATURE_SI, NATURE_SI_SINON, NATURE_SI_SI, NATURE_SI_SI_SINON 
+ *            ou NATURE_SWITCH).
+ */
+    StructureConditionnelle (NatureStructure nature);
 };
 #endif
\ No newline at end of file
@@ -12,17 +12,91 @@
 #ifndef STRUCTURE_DE_CONTROLE_H
 #define STRUCTURE_DE_CONTROLE_H
 
+#include "EtendueSource.h"
+
+class VisiteurStructure;
+
+/**
+ *  \enum NatureStructure
+ *  \brief Les différentes natures de structures de contrôle.
+ *  \details La nature d'une structure de contrôle est fixée à sa construction. Elle permet d'aiguiller
+ *           un traitement selon la nature de la structure à l'aide d'une seule instruction \c switch.
+ */
+enum NatureStructure
+{
+    NATURE_SI,                                 /**< structure de type StructureSi */
+    NATURE_SI_SINON,                           /**< structure de type StructureSiSinon */
+    NATURE_SI_SI,                              /**< structure de type StructureSiSi */
+    NATURE_SI_SI_SINON,                        /**< structure de type StructureSiSiSinon */
+    NATURE_SWITCH,                             /**< structure de type StructureSwitch */
+    NATURE_ITERATIVE_NBRE_REPET_CONNU,         /**< itération avec nombre de répétitions connu */
+    NATURE_ITERATIVE_COND_AU_DEBUT,            /**< itération avec nombre de répétitions inconnu et condition au début */
+    NATURE_ITERATIVE_COND_A_LA_FIN,            /**< itération avec nombre de répétitions inconnu et condition à la fin */
+    NATURE_ITERATIVE_COND_AU_MILIEU,           /**< itération avec nombre de répétitions inconnu et condition au milieu */
+    NATURE_ITERATIVE_COND_MULTIPLES,           /**< itération avec nombre de répétitions inconnu et conditions multiples */
+    NATURE_IMBRIQUEE                           /**< structure de type StructureImbriquee */
+};
+
+/**
+ *  \enum CategorieStructure
+ *  \brief Les familles auxquelles une structure de contrôle peut appartenir.
+ *  \details Les valeurs sont des puissances de 2 pouvant être combinées à l'aide de l'opérateur \c | . 
+ *           Les catégories d'une structure se déduisent de sa nature (voir getCategoriesNature()).
+ */
+enum CategorieStructure
+{
+    CATEGORIE_CONDITIONNELLE      = 1 << 0, /**< structure conditionnelle */
+    CATEGORIE_ITERATIVE           = 1 << 1, /**< structure itérative */
+    CATEGORIE_NBRE_REPET_CONNU    = 1 << 2, /**< structure itérative avec nombre de répétitions connu */
+    CATEGORIE_NBRE_REPET_INCONNU  = 1 << 3, /**< structure itérative avec nombre de répétitions inconnu */
+    CATEGORIE_IMBRIQUEE           = 1 << 4  /**< structure contenant d'autres structures de contrôle */
+};
+
+/**
+ * \brief    Donne les catégories (voir CategorieStructure) correspondant à une nature de structure de contrôle.
+ * \details  Les catégories sont lues dans une table indexée par la nature : aucun test n'est réalisé.
+ * \param[in]  nature  La nature de la structure de contrôle.
+ * \return   Une combinaison de valeurs de l'énumération CategorieStructure.
+ */
+unsigned char getCategoriesNature (NatureStructure nature);
+
+
 /** 
  *  \class StructureDeControle
  *  \brief Une classe pour constuire et réprésenter les structures de contrôle utilisées dans un code. 
+ *  \details Chaque structure de contrôle porte une nature (voir NatureStructure) et un masque de catégories 
+ *           (voir CategorieStructure), fixés à sa construction. Les méthodes estUne...() se contentent de
+ *           comparer la nature ou de tester un bit du masque : elles ne sont pas virtuelles et ne font pas
+ *           appel à l'identification de type à l'exécution (RTTI).
  */
 class StructureDeControle
 {
 public:
+    /**
+ * \brief    Indique la nature de la structure de contrôle.
+ * \return   Une valeur de l'énumération NatureStructure.
+ */
+    NatureStructure getNature ();
+
+    /**
+ * \brief    Indique les catégories auxquelles appartient la structure de contrôle.
+ * \return   Une combinaison de valeurs de l'énumération CategorieStructure.
+ */
+    unsigned char getCategories ();
+
+    /**
+ * \brief    Transmet la structure de contrôle à un visiteur.
+ * \details  La méthode du visiteur correspondant à la nature de la structure est appelée, après conversion
+ *           de la structure dans son type réel. L'aiguillage est réalisé par un \c switch sur la nature.
+ * \param[in]  visiteur  Le visiteur auquel transmettre la structure.
+ */
+    void accepter (VisiteurStructure* visiteur);
+
     /**
  * \brief    Indique si la structure de contrôle est une structure imbriquée 
  *           (contenant d'autres structures de contrôle).
- * \return   \c true si la structure de contrôle est une structure imbriquée, \c false sinon.
+ * \return   \c true si la structure de contrôle est une structure imbriquée 
+ *           (bit CATEGORIE_IMBRIQUEE de son masque de catégories), \c false sinon.
  */
     bool getEstUneStructureImbriquee(); 
 
@@ -116,12 +190,49 @@ public:
  */
     bool estUneIterativeAvecNbreRepetInconnuEtCondMultiples(); 
 
+    /**
+ * \brief    Indique la portion du fichier source à partir de laquelle la structure de contrôle a été construite.
+ * \return   Un objet EtendueSource délimitant la structure de contrôle dans le fichier source, du mot-clé 
+ *           introduisant la structure jusqu'à la fin de son dernier bloc.
+ */
+    EtendueSource getEtendue ();
+
+    /**
+ * \brief    Définit la portion du fichier source à partir de laquelle la structure de contrôle a été construite.
+ * \details  La fin de la structure n'étant connue qu'une fois son dernier bloc lu, l'étendue est définie
+ *           après la construction, par l'analyse du code (ou par Code::appliquerModification() lorsqu'elle 
+ *           est décalée).
+ * \param[in]  etendue  Un objet EtendueSource délimitant la structure de contrôle dans le fichier source.
+ */
+    void setEtendue (EtendueSource etendue);
+
+
 protected:
 
+/**
+ * \brief    Constructeur : construit une structure de contrôle d'une nature donnée.
+ * \param[in] nature  La nature de la structure de contrôle. \n
+ *           Les catégories de la structure sont déduites de cette nature.
+ */
+    StructureDeControle (NatureStructure nature);
+
+    /**
+ *   \var NatureStructure nature
+ *   \brief La nature de la structure de contrôle, fixée à sa construction. 
+ */
+    NatureStructure nature;
+
     /**
- *   \var bool estUneStructureImbriquee
- *   \brief Indique si la structure de contrôle contient d'autres structures de contrôle. 
+ *   \var unsigned char categories
+ *   \brief Le masque des catégories (CategorieStructure) auxquelles appartient la structure de contrôle. 
  */
-    bool estUneStructureImbriquee;    
+    unsigned char categories;
+
+    /**
+ *   \var EtendueSource etendue
+ *   \brief La portion du fichier source à partir de laquelle la structure de contrôle a été construite.
+ */
+    EtendueSource etendue;
+
 };
 #endif
\ No newline at end of file
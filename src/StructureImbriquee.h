@@ -23,7 +23,8 @@ class StructureImbriquee : public StructureDeControle
 {
 public:
 /**
- * \brief    Constructeur : construit un objet variable structurée.
+ * \brief    Constructeur : construit une structure de contrôle imbriquée.
+ * \details  La structure est de nature NATURE_IMBRIQUEE.
  * \param[in] structuresImbriquees la liste des structures de contrôle imbriquées dans la structure.  
  */
     StructureImbriquee (const StructureDeControle*[] structuresImbriquees);
@@ -0,0 +1,87 @@
+/**
+ * \file      StructureIterative.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe StructureIterative.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe StructureIterative. Il s'agit d'une
+ *             classe abstraite qui fait référence à une structure itérative présente dans le code (structure
+ *             \c for , \c while , \c do \c while etc.)
+ */
+
+#ifndef STRUCTURE_ITERATIVE_H
+#define STRUCTURE_ITERATIVE_H
+
+#include "StructureSimple.h"
+#include "ConditionDeBoucle.h"
+#include "Traitement.h"
+
+/** 
+ *  \class StructureIterative
+ *  \brief Une classe pour constuire et réprésenter les structures itératives présentes dans un code. 
+ *  \details Il s'agit d'une classe abstraite : une structure itérative est soit une 
+ *           IterationAvecNombreDeRepetitionsConnu, soit une IterationAvecNombreDeRepetitionsInconnu.
+ */
+class StructureIterative : public StructureSimple
+{
+public:
+  virtual ~StructureIterative() = 0;
+
+
+    /**
+ * \brief    Indique le nombre de conditions de boucle de l'itération.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned int getNbreConditionsDeBoucle ();
+
+    /**
+ * \brief    Indique les conditions de continuation ou d'arrêt de l'itération.
+ * \return   Un tableau d'objets ConditionDeBoucle, rangés dans leur ordre d'évaluation au sein de l'itération.
+ */
+    ConditionDeBoucle* getConditionsDeBoucle ();
+
+    /**
+ * \brief    Ajoute une condition de boucle à l'itération.
+ * \param[in]  condition  La condition de continuation ou d'arrêt à ajouter.
+ */
+    void addConditionDeBoucle (ConditionDeBoucle* condition);
+
+
+    /**
+ * \brief    Indique le ou les traitements répétés par l'itération.
+ * \return   Un ensemble d'objets Traitement formant le corps de l'itération.
+ */
+    Traitement* getTraitements ();
+
+    /**
+ * \brief    Ajoute un traitement au corps de l'itération.
+ * \param[in]  traitement  Le traitement à ajouter.
+ */
+    void addTraitement (Traitement* traitement);
+
+
+protected:
+/**
+ * \brief    Constructeur : construit une structure itérative d'une nature donnée.
+ * \param[in] nature  La nature de l'itération (l'une des natures NATURE_ITERATIVE_...).
+ */
+    StructureIterative (NatureStructure nature);
+
+    /**
+    \var unsigned int nbreConditionsDeBoucle
+    \brief le nombre de conditions de boucle de l'itération.
+*/
+    unsigned int nbreConditionsDeBoucle;
+
+    /**
+    \var ConditionDeBoucle* conditionsDeBoucle
+    \brief les conditions de continuation ou d'arrêt de l'itération.
+*/
+    ConditionDeBoucle* conditionsDeBoucle;
+
+    /**
+    \var Traitement* traitements
+    \brief les traitements répétés par l'itération.
+*/
+    Traitement* traitements;
+};
+#endif
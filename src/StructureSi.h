@@ -12,6 +12,7 @@
 #define STRUCTURE_SI
 
 #include "StructureConditionnelle.h"
+#include "ConditionSi.h"
 
 /** 
  *  \class StructureSi
@@ -23,6 +24,7 @@ class StructureSi : public StructureConditionnelle
 public:
 /**
  * \brief    Constructeur : construit une structure conditionnelle de type Si.
+ * \details  La structure est de nature NATURE_SI.
  * \param[in] conditionSi représente la partie Si de la structure. 
  */
     StructureSi (ConditionSi conditionSi);
@@ -12,6 +12,7 @@
 #define STRUCTURE_SI_SI_H
 
 #include "StructureConditionnelle.h"
+#include "ConditionSi.h"
 
 /** 
  *  \class StructureSiSi
@@ -23,6 +24,7 @@ class StructureSiSi : public StructureConditionnelle
 public:
 /**
  * \brief    Constructeur : construit une structure conditionnelle de type Si-Si.
+ * \details  La structure est de nature NATURE_SI_SI.
  * \param[in] conditionsSi représente la liste des conditionsSi composant la structure Si-Si. 
  */
     StructureSiSi (ConditionSi*[] conditionsSi);
@@ -12,6 +12,8 @@
 #define STRUCTURE_SI_SINON_H
 
 #include "StructureConditionnelle.h"
+#include "ConditionSi.h"
+#include "ConditionSinon.h"
 
 /** 
  *  \class StructureSiSinon
@@ -23,6 +25,7 @@ class StructureSiSinon : public StructureConditionnelle
 public:
 /**
  * \brief    Constructeur : construit une structure conditionnelle de type Si-Sinon.
+ * \details  La structure est de nature NATURE_SI_SINON.
  * \param[in] conditionSi représente la partie Si de la structure. 
  * \param[in] conditionSinon représente la partie Sinon de la structure. 
  */
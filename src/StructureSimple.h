@@ -29,5 +29,10 @@ public:
   virtual ~StructureSimple() = 0;
  
 protected:
+/**
+ * \brief    Constructeur : construit une structure simple d'une nature donnée.
+ * \param[in] nature  La nature de la structure, transmise au constructeur de StructureDeControle.
+ */
+    StructureSimple (NatureStructure nature);
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,192 @@
+/**
+ * \file      TableExpressions.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe TableExpressions.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe TableExpressions permettant de représenter
+ *             les expressions (booléennes notamment) d'un code sous forme d'un graphe orienté sans circuit
+ *             dans lequel chaque sous-expression n'est stockée qu'une seule fois.
+ */
+
+#ifndef TABLE_EXPRESSIONS_H
+#define TABLE_EXPRESSIONS_H
+
+#include "Information.h"
+#include "Valeur.h"
+
+/**
+ * \brief    Numéro désignant une expression stockée dans une TableExpressions.
+ * \details  Deux expressions identiques (au sens de TableExpressions) ont toujours le même numéro : 
+ *           comparer deux expressions revient à comparer deux entiers.
+ */
+typedef unsigned int IdExpression;
+
+/**
+ * \brief    Valeur d'un IdExpression ne désignant aucune expression.
+ */
+const IdExpression EXPRESSION_NULLE = 0xFFFFFFFF;
+
+
+/**
+ *  \enum OperateurExpression
+ *  \brief Les opérateurs pouvant figurer dans une expression.
+ */
+enum OperateurExpression
+{
+    OPERATEUR_INFORMATION,        /**< feuille : une Information (variable, constante) */
+    OPERATEUR_LITTERAL,           /**< feuille : une valeur écrite en dur dans le code (nombre magique) */
+    OPERATEUR_NON,                /**< \c ! (un seul opérande) */
+    OPERATEUR_ET,                 /**< \c && */
+    OPERATEUR_OU,                 /**< \c || */
+    OPERATEUR_EGAL,               /**< \c == */
+    OPERATEUR_DIFFERENT,          /**< \c != */
+    OPERATEUR_INFERIEUR,          /**< \c < */
+    OPERATEUR_INFERIEUR_OU_EGAL,  /**< \c <= */
+    OPERATEUR_SUPERIEUR,          /**< \c > */
+    OPERATEUR_SUPERIEUR_OU_EGAL,  /**< \c >= */
+    OPERATEUR_ADDITION,           /**< \c + */
+    OPERATEUR_SOUSTRACTION,       /**< \c - */
+    OPERATEUR_MULTIPLICATION,     /**< \c * */
+    OPERATEUR_DIVISION,           /**< \c / */
+    OPERATEUR_MODULO,             /**< \c % */
+    OPERATEUR_APPEL               /**< appel de fonction ou expression non reconnue, identifiée par son texte */
+};
+
+
+/**
+ *  \struct NoeudExpression
+ *  \brief Un enregistrement décrivant un nœud du graphe des expressions.
+ */
+struct NoeudExpression
+{
+    /**
+    \var OperateurExpression operateur
+    \brief l'opérateur du nœud.
+*/
+    OperateurExpression operateur;
+
+    /**
+    \var IdExpression gauche
+    \brief le premier opérande (EXPRESSION_NULLE pour une feuille).
+*/
+    IdExpression gauche;
+
+    /**
+    \var IdExpression droite
+    \brief le second opérande (EXPRESSION_NULLE pour une feuille ou un opérateur à un seul opérande).
+*/
+    IdExpression droite;
+
+    /**
+    \var Information* information
+    \brief l'information désignée par une feuille OPERATEUR_INFORMATION (\c null pour les autres nœuds).
+*/
+    Information* information;
+
+    /**
+    \var Valeur valeur
+    \brief la valeur désignée par une feuille OPERATEUR_LITTERAL (de nature VALEUR_AUCUNE pour les autres nœuds).
+*/
+    Valeur valeur;
+
+    /**
+    \var IdIdentifiant texte
+    \brief pour OPERATEUR_APPEL, le texte (normalisé) de l'expression dans la table des identifiants du code.
+*/
+    IdIdentifiant texte;
+};
+
+
+/**
+ *  \class TableExpressions
+ *  \brief Une classe pour stocker les expressions d'un code sous forme d'un graphe orienté sans circuit 
+ *         dont chaque nœud est unique.
+ *  \details Avant de créer un nœud, la table recherche (par hachage de l'opérateur et des numéros de ses
+ *           opérandes) un nœud identique : s'il existe, son numéro est réutilisé. Une sous-expression
+ *           répétée dans plusieurs conditions (une longue suite de \c else \c if par exemple) n'est donc 
+ *           stockée qu'une seule fois, et deux conditions identiques portent le même IdExpression. \n
+ *           Les opérandes des opérateurs commutatifs (\c ==, \c !=, \c +, \c *) sont rangés dans l'ordre 
+ *           croissant de leur numéro, \c a \c > \c b est rangé comme \c b \c < \c a et \c a \c >= \c b comme 
+ *           \c b \c <= \c a : ainsi <tt>VAL_ARRET_SAISIE == valeurSaisie</tt> et <tt>valeurSaisie == VAL_ARRET_SAISIE</tt> 
+ *           désignent la même expression. Les opérandes de \c && et \c || ne sont jamais réordonnés : 
+ *           l'évaluation de ces opérateurs est court-circuitée, et <tt>p != null && p->x</tt> n'est pas 
+ *           équivalent à <tt>p->x && p != null</tt>. \n
+ *           Les feuilles désignant une valeur écrite en dur (NombreMagique) sont identifiées par cette valeur 
+ *           (voir Valeur::getEmpreinte()) et non par l'objet NombreMagique : deux occurrences du même littéral
+ *           désignent la même feuille.
+ */
+class TableExpressions
+{
+public:
+/**
+ * \brief    Constructeur : construit une table d'expressions vide.
+ */
+    TableExpressions ();
+
+
+    /**
+ * \brief    Fournit le numéro de la feuille désignant une information, en la créant si besoin.
+ * \details  Pour un NombreMagique, la feuille retournée est celle de sa valeur (voir getFeuilleLitterale()).
+ * \param[in]  information  L'information désignée par la feuille.
+ * \return   Le numéro de la feuille.
+ */
+    IdExpression getFeuille (Information* information);
+
+    /**
+ * \brief    Fournit le numéro de la feuille désignant une valeur écrite en dur, en la créant si besoin.
+ * \param[in]  valeur  La valeur désignée par la feuille.
+ * \return   Le numéro de la feuille (OPERATEUR_LITTERAL).
+ */
+    IdExpression getFeuilleLitterale (Valeur valeur);
+
+    /**
+ * \brief    Fournit le numéro du nœud formé d'un opérateur et de ses opérandes, en le créant si besoin.
+ * \param[in]  operateur  L'opérateur du nœud.
+ * \param[in]  gauche  Le premier opérande.
+ * \param[in]  droite  Le second opérande (EXPRESSION_NULLE pour OPERATEUR_NON).
+ * \return   Le numéro du nœud.
+ */
+    IdExpression getNoeud (OperateurExpression operateur, IdExpression gauche, IdExpression droite = EXPRESSION_NULLE);
+
+    /**
+ * \brief    Fournit le numéro du nœud désignant une expression non décomposée (appel de fonction...).
+ * \param[in]  texte  Le numéro, dans la table des identifiants du code, du texte normalisé de l'expression.
+ * \return   Le numéro du nœud.
+ */
+    IdExpression getNoeudAppel (IdIdentifiant texte);
+
+
+    /**
+ * \brief    Donne accès à la description d'un nœud.
+ * \param[in]  expression  Le numéro du nœud.
+ * \return   L'enregistrement décrivant le nœud.
+ */
+    const NoeudExpression* getNoeudExpression (IdExpression expression);
+
+    /**
+ * \brief    Indique le nombre de nœuds distincts de la table.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned int getNbreNoeuds ();
+
+
+private:
+    /**
+    \var unsigned int nbreNoeuds
+    \brief le nombre de nœuds distincts de la table.
+*/
+    unsigned int nbreNoeuds;
+
+    /**
+    \var NoeudExpression* noeuds
+    \brief les nœuds de la table, rangés selon leur numéro.
+*/
+    NoeudExpression* noeuds;
+
+    /**
+    \var IdExpression* alveoles
+    \brief la table de hachage associant la description d'un nœud à son numéro.
+*/
+    IdExpression* alveoles;
+};
+#endif
@@ -0,0 +1,175 @@
+/**
+ * \file      TableIdentifiants.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe TableIdentifiants.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe TableIdentifiants permettant de ne
+ *             stocker qu'une seule fois chacun des noms (d'informations, de traitements, de types...)
+ *             rencontrés lors de l'analyse d'un ou plusieurs codes.
+ */
+
+#ifndef TABLE_IDENTIFIANTS_H
+#define TABLE_IDENTIFIANTS_H
+
+/**
+ * \brief    Numéro désignant un nom stocké dans une TableIdentifiants.
+ * \details  Deux noms identiques ont toujours le même IdIdentifiant : comparer deux noms revient
+ *           à comparer deux entiers.
+ */
+typedef unsigned int IdIdentifiant;
+
+/**
+ * \brief    Taille (en octets) des blocs dans lesquels sont rangés les caractères des noms d'une TableIdentifiants.
+ */
+const unsigned int TAILLE_BLOC_IDENTIFIANTS = 1 << 16;
+
+/**
+ * \brief    Nombre de vues contenues dans chacune des pages d'une TableIdentifiants.
+ */
+const unsigned int TAILLE_PAGE_IDENTIFIANTS = 1 << 12;
+
+
+/**
+ *  \class TableIdentifiants
+ *  \brief Une classe pour stocker une seule fois chacun des noms utilisés dans un code (ou un projet).
+ *  \details Chaque nom est recherché dans une table de hachage : s'il est absent, ses caractères sont recopiés
+ *           dans un bloc de caractères et un nouvel IdIdentifiant lui est attribué. \n
+ *           Les caractères sont rangés dans des blocs de TAILLE_BLOC_IDENTIFIANTS octets qui ne sont jamais
+ *           déplacés ni agrandis : lorsque le bloc courant est plein, un nouveau bloc est réservé (un nom plus
+ *           long qu'un bloc reçoit un bloc à sa taille). De même, la position de chaque nom est rangée dans des
+ *           pages de taille fixe, désignées par un répertoire de pages de taille fixe. \n
+ *           Les noms sont restitués sous forme de \c string_view : aucune copie n'est réalisée lors
+ *           de leur consultation. Les blocs n'étant jamais déplacés, les vues restent valides tant que la table existe. \n
+ *           Une même table peut être remplie simultanément par plusieurs fils d'exécution (voir Projet) :
+ *           interner() est protégée par un verrou. Pour limiter les prises de verrou, chaque fil d'exécution
+ *           dispose d'un cache local (voir CacheLocal) qu'il consulte en premier, et ne s'adresse à la table
+ *           que pour les noms qu'il rencontre pour la première fois. getNom() ne prend pas de verrou : 
+ *           un nom déjà interné n'est jamais modifié.
+ */
+class TableIdentifiants
+{
+public:
+/**
+ * \brief    Constructeur : construit une table vide.
+ */
+    TableIdentifiants ();
+
+
+    /**
+ * \brief    Fournit le numéro d'un nom, en ajoutant ce nom à la table s'il n'y figure pas encore.
+ * \param[in]  nom  Le nom à rechercher. \n
+ *           Par exemple : "sommeNotes"
+ * \return   Le numéro désignant le nom dans la table.
+ */
+    IdIdentifiant interner (string_view nom);
+
+    /**
+ * \class    CacheLocal
+ * \brief    Un cache, propre à un fil d'exécution, des noms déjà internés dans une table partagée.
+ * \details  Un CacheLocal n'est utilisé que par le fil d'exécution qui l'a créé : il n'est pas protégé
+ *           par un verrou. Il est détruit à la fin de l'analyse des fichiers confiés à ce fil.
+ */
+    class CacheLocal
+    {
+    public:
+        /**
+     * \brief    Constructeur : construit un cache vide associé à une table.
+     * \param[in] table  La table partagée.
+     */
+        CacheLocal (TableIdentifiants* table);
+
+        /**
+     * \brief    Fournit le numéro d'un nom, en consultant d'abord le cache puis, si besoin, la table partagée.
+     * \param[in]  nom  Le nom à rechercher.
+     * \return   Le numéro désignant le nom dans la table partagée.
+     */
+        IdIdentifiant interner (string_view nom);
+
+    private:
+        /**
+        \var TableIdentifiants* table
+        \brief la table partagée.
+    */
+        TableIdentifiants* table;
+
+        /**
+        \var IdIdentifiant* alveoles
+        \brief la table de hachage locale associant un nom (lu dans la table partagée) à son numéro.
+    */
+        IdIdentifiant* alveoles;
+    };
+
+    /**
+ * \brief    Restitue le nom correspondant à un numéro.
+ * \param[in]  id  Le numéro du nom (obtenu par interner()).
+ * \return   Une vue sur les caractères du nom stockés dans la table.
+ */
+    string_view getNom (IdIdentifiant id);
+
+
+    /**
+ * \brief    Indique combien de noms différents sont stockés dans la table.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned int getNbreIdentifiants ();
+
+    /**
+ * \brief    Indique combien de fois un nom a été demandé (déjà présent ou non) depuis la création de la table.
+ * \details  Le rapport entre cette valeur et getNbreIdentifiants() donne le nombre moyen d'occurrences
+ *           d'un même nom, c'est-à-dire le nombre de copies évitées par la table.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned long int getNbreOccurrences ();
+
+    /**
+ * \brief    Indique la place occupée par les noms stockés dans la table.
+ * \return   Un entier positif ou nul correspondant au nombre d'octets occupés (caractères et table de hachage).
+ */
+    unsigned long int getTailleOccupee ();
+
+
+private:
+    /**
+    \var char** blocs
+    \brief les blocs de caractères réservés par la table, jamais déplacés.
+*/
+    char** blocs;
+
+    /**
+    \var unsigned int positionBlocCourant
+    \brief la position, dans le dernier bloc réservé, à partir de laquelle le prochain nom sera recopié.
+*/
+    unsigned int positionBlocCourant;
+
+    /**
+    \var string_view** pages
+    \brief le répertoire (de taille fixe) des pages de vues : la vue du nom \c id est 
+           pages[id / TAILLE_PAGE_IDENTIFIANTS][id % TAILLE_PAGE_IDENTIFIANTS]. Une page n'est jamais déplacée.
+*/
+    string_view** pages;
+
+    /**
+    \var mutex verrou
+    \brief le verrou protégeant interner() lorsque la table est partagée par plusieurs fils d'exécution.
+*/
+    mutex verrou;
+
+    /**
+    \var IdIdentifiant* alveoles
+    \brief la table de hachage (adressage ouvert) associant un nom à son numéro.
+*/
+    IdIdentifiant* alveoles;
+
+    /**
+    \var unsigned int nbreIdentifiants
+    \brief le nombre de noms différents stockés dans la table.
+*/
+    unsigned int nbreIdentifiants;
+
+    /**
+    \var unsigned long int nbreOccurrences
+    \brief le nombre de fois qu'un nom a été demandé à la table.
+*/
+    unsigned long int nbreOccurrences;
+};
+#endif
@@ -0,0 +1,151 @@
+/**
+ * \file      TableMetriques.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe TableMetriques.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe TableMetriques permettant de ranger les
+ *             métriques (complexité cyclomatique, profondeur d'imbrication...) calculées sur des traitements
+ *             ou des codes.
+ */
+
+#ifndef TABLE_METRIQUES_H
+#define TABLE_METRIQUES_H
+
+/**
+ * \brief    Valeur de la colonne des numéros de traitement pour une ligne portant sur un code entier.
+ */
+const unsigned int TOUS_TRAITEMENTS = 0xFFFFFFFF;
+
+/**
+ * \brief    Valeur de la colonne des numéros de traitement pour la ligne regroupant les structures de contrôle
+ *           d'un code qui ne sont contenues dans aucun traitement (voir NoeudArbreStructures::traitement).
+ */
+const unsigned int HORS_TRAITEMENTS = 0xFFFFFFFE;
+
+
+/**
+ *  \class TableMetriques
+ *  \brief Une classe pour représenter un ensemble de métriques sous forme de table rangée par colonnes.
+ *  \details Chaque ligne de la table porte sur un traitement (ou sur un code entier). Les valeurs d'une même
+ *           métrique sont rangées de manière contiguë dans un tableau (une colonne) : calculer une statistique
+ *           sur une métrique (moyenne, maximum...) ou exporter une colonne ne nécessite donc de lire que
+ *           cette colonne.
+ */
+class TableMetriques
+{
+public:
+/**
+ * \brief    Constructeur : construit une table de métriques.
+ * \param[in] nbreLignes  Le nombre de lignes de la table.
+ */
+    TableMetriques (unsigned int nbreLignes);
+
+
+    /**
+ * \brief    Indique le nombre de lignes de la table.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned int getNbreLignes ();
+
+
+    /**
+ * \brief    Donne accès à la colonne des numéros de codes.
+ * \return   Pour chaque ligne, la position (dans Projet::getCodes()) du code concerné, 0 pour un code analysé seul.
+ */
+    unsigned int* getNumerosCodes ();
+
+    /**
+ * \brief    Donne accès à la colonne des numéros de traitements.
+ * \return   Pour chaque ligne, le numéro (voir Traitement::getNumero()) du traitement concerné, 
+ *           la valeur HORS_TRAITEMENTS pour la ligne regroupant les structures situées hors de tout traitement,
+ *           ou la valeur TOUS_TRAITEMENTS pour une ligne portant sur un code entier.
+ */
+    unsigned int* getNumerosTraitements ();
+
+    /**
+ * \brief    Donne accès à la colonne des complexités cyclomatiques.
+ * \return   Pour chaque ligne, la complexité cyclomatique (1 + nombre de points de décision).
+ */
+    unsigned int* getComplexitesCyclomatiques ();
+
+    /**
+ * \brief    Donne accès à la colonne des profondeurs d'imbrication.
+ * \return   Pour chaque ligne, la profondeur maximale d'imbrication des structures de contrôle.
+ */
+    unsigned short int* getProfondeursMaximales ();
+
+    /**
+ * \brief    Donne accès à la colonne des nombres de branches.
+ * \return   Pour chaque ligne, le nombre de branches (ConditionSi, ConditionSinon, cas d'un \c switch...)
+ *           des structures conditionnelles.
+ */
+    unsigned int* getNbresBranches ();
+
+    /**
+ * \brief    Donne accès à la colonne des nombres de structures itératives.
+ * \return   Pour chaque ligne, le nombre de structures itératives.
+ */
+    unsigned int* getNbresIterations ();
+
+
+    /**
+ * \brief    Regroupe les lignes de la table code par code.
+ * \details  La complexité cyclomatique et les nombres de branches et d'itérations d'un code sont les sommes 
+ *           de ceux de ses lignes (traitements et ligne HORS_TRAITEMENTS) ; sa profondeur d'imbrication est le 
+ *           maximum de celles de ses lignes.
+ * \return   Une nouvelle table comportant une ligne par code, dont le numéro de traitement vaut TOUS_TRAITEMENTS.
+ */
+    TableMetriques* agregerParCode ();
+
+
+    /**
+ * \brief    Écrit la table dans un fichier au format CSV (une ligne d'entête puis une ligne par ligne de la table).
+ * \param[in]  cheminFichier  Le chemin d'accès au fichier à écrire.
+ */
+    void exporterCSV (string cheminFichier);
+
+
+private:
+    /**
+    \var unsigned int nbreLignes
+    \brief le nombre de lignes de la table.
+*/
+    unsigned int nbreLignes;
+
+    /**
+    \var unsigned int* numerosCodes
+    \brief la colonne des numéros de codes.
+*/
+    unsigned int* numerosCodes;
+
+    /**
+    \var unsigned int* numerosTraitements
+    \brief la colonne des numéros de traitements.
+*/
+    unsigned int* numerosTraitements;
+
+    /**
+    \var unsigned int* complexitesCyclomatiques
+    \brief la colonne des complexités cyclomatiques.
+*/
+    unsigned int* complexitesCyclomatiques;
+
+    /**
+    \var unsigned short int* profondeursMaximales
+    \brief la colonne des profondeurs maximales d'imbrication.
+*/
+    unsigned short int* profondeursMaximales;
+
+    /**
+    \var unsigned int* nbresBranches
+    \brief la colonne des nombres de branches.
+*/
+    unsigned int* nbresBranches;
+
+    /**
+    \var unsigned int* nbresIterations
+    \brief la colonne des nombres de structures itératives.
+*/
+    unsigned int* nbresIterations;
+};
+#endif
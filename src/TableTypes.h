@@ -0,0 +1,146 @@
+/**
+ * \file      TableTypes.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe TableTypes.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe TableTypes permettant de garantir
+ *             que chaque type utilisé dans un code (ou un projet) n'est représenté que par un seul objet Type.
+ */
+
+#ifndef TABLE_TYPES_H
+#define TABLE_TYPES_H
+
+#include "Type.h"
+#include "TableIdentifiants.h"
+
+/**
+ * \brief    Nombre d'objets Type contenus dans chacune des pages d'une TableTypes.
+ */
+const unsigned int TAILLE_PAGE_TYPES = 1 << 10;
+
+/**
+ *  \class TableTypes
+ *  \brief Une classe pour créer et retrouver les types utilisés dans un code (ou un projet).
+ *  \details Le nom d'un type est d'abord mis sous forme canonique ("int [ ]" devient "int[]") puis stocké
+ *           dans la table des identifiants : deux noms de types identiques ont donc le même IdIdentifiant. 
+ *           La table associe à chaque IdIdentifiant l'unique objet Type correspondant, ce qui permet de 
+ *           retrouver un type déjà créé en temps constant. \n
+ *           Les types tableaux et génériques sont créés récursivement : obtenir \c vector<int[]> crée
+ *           (ou retrouve) également \c int[] puis \c int. \n
+ *           Les objets Type sont rangés dans des pages de TAILLE_PAGE_TYPES objets, désignées par un répertoire
+ *           de pages de taille fixe. Une page n'est jamais déplacée ni agrandie : l'adresse d'un Type reste donc
+ *           valide tant que la table existe, et peut être conservée par les informations des codes. \n
+ *           Une table partagée par plusieurs fils d'exécution (voir Projet::getTableTypes()) est protégée par un 
+ *           verrou, pris par getType() et rechercherType(). Chaque fil d'exécution consulte d'abord son cache
+ *           local (voir TableTypes::CacheLocal) et ne prend le verrou que pour un type qu'il rencontre pour 
+ *           la première fois. getTypeParNumero() ne prend pas de verrou : un type créé n'est jamais modifié.
+ */
+class TableTypes
+{
+public:
+/**
+ * \brief    Constructeur : construit une table de types vide.
+ * \param[in] tableIdentifiants  La table dans laquelle sont stockés les noms des types.
+ */
+    TableTypes (TableIdentifiants* tableIdentifiants);
+
+
+    /**
+ * \brief    Fournit le type correspondant à un nom, en le créant s'il n'existe pas encore.
+ * \param[in]  nom  Le nom du type tel qu'il apparaît dans le code source. \n
+ *           Par exemple : "int[]"
+ * \return   L'unique objet Type correspondant à ce nom.
+ */
+    Type* getType (string_view nom);
+
+    /**
+ * \brief    Recherche le type correspondant à un nom, sans le créer.
+ * \param[in]  nom  Le nom du type.
+ * \return   L'objet Type correspondant à ce nom, ou la valeur \c null si aucun type de ce nom n'existe.
+ */
+    Type* rechercherType (string_view nom);
+
+    /**
+ * \class    CacheLocal
+ * \brief    Un cache, propre à un fil d'exécution, des types déjà obtenus auprès d'une table partagée.
+ * \details  Le cache associe l'IdIdentifiant du nom canonique d'un type à l'adresse du Type : il n'est utilisé
+ *           que par le fil d'exécution qui l'a créé et n'est pas protégé par un verrou.
+ */
+    class CacheLocal
+    {
+    public:
+        /**
+     * \brief    Constructeur : construit un cache vide associé à une table.
+     * \param[in] table  La table partagée.
+     */
+        CacheLocal (TableTypes* table);
+
+        /**
+     * \brief    Fournit le type correspondant à un nom, en consultant d'abord le cache puis, si besoin, la table partagée.
+     * \param[in]  nom  Le nom du type.
+     * \return   L'unique objet Type correspondant à ce nom.
+     */
+        Type* getType (string_view nom);
+
+    private:
+        /**
+        \var TableTypes* table
+        \brief la table partagée.
+    */
+        TableTypes* table;
+
+        /**
+        \var Type** alveoles
+        \brief la table de hachage locale associant l'IdIdentifiant du nom d'un type à ce type.
+    */
+        Type** alveoles;
+    };
+
+
+    /**
+ * \brief    Indique le nombre de types distincts de la table.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned int getNbreTypes ();
+
+    /**
+ * \brief    Donne accès à un type de la table à partir de son numéro.
+ * \param[in]  numero  Le numéro du type (voir Type::getNumero()), compris entre 0 et getNbreTypes() - 1.
+ * \return   L'objet Type portant ce numéro.
+ */
+    Type* getTypeParNumero (unsigned int numero);
+
+
+private:
+    /**
+    \var TableIdentifiants* tableIdentifiants
+    \brief la table dans laquelle sont stockés les noms des types.
+*/
+    TableIdentifiants* tableIdentifiants;
+
+    /**
+    \var unsigned int nbreTypes
+    \brief le nombre de types distincts de la table.
+*/
+    unsigned int nbreTypes;
+
+    /**
+    \var Type** pages
+    \brief le répertoire (de taille fixe) des pages de types : le type numéro \c n est 
+           pages[n / TAILLE_PAGE_TYPES][n % TAILLE_PAGE_TYPES]. Une page n'est jamais déplacée.
+*/
+    Type** pages;
+
+    /**
+    \var unsigned int* alveoles
+    \brief la table de hachage associant l'IdIdentifiant du nom d'un type au numéro de ce type.
+*/
+    unsigned int* alveoles;
+
+    /**
+    \var mutex verrou
+    \brief le verrou protégeant getType() et rechercherType() lorsque la table est partagée.
+*/
+    mutex verrou;
+};
+#endif
@@ -13,6 +13,10 @@
 
 #include "Code.h"
 #include "Information.h"
+#include "ArenaCode.h"
+#include "TableIdentifiants.h"
+#include "EtendueSource.h"
+#include "ContratTraitement.h"
 
 /** 
  *  \class Traitement
@@ -24,11 +28,14 @@ class Traitement
 public:
     /**
  * \brief    Constructeur : construit un objet Traitement à partir de son nom.
- * \param[in] nom  Le nom du traitement. \n
+ * \param[in] nom  Une vue sur le nom du traitement, par exemple sur l'action de son contrat (voir ContratTraitement). \n
+ *           Le nom est interné dans la table des identifiants du code (voir Code::getTableIdentifiants()) : 
+ *           la vue n'a pas besoin de rester valide après la construction. \n
  *           Par exemple : "Calculer périmètre"
- * \param[in] code  Le code dans lequel le traitement est programmé.
+ * \param[in] code  Le code dans lequel le traitement est programmé. \n
+ *           Le traitement est alloué dans l'arène de ce code (voir Code::getArena()).
  */
-    Traitement(String nom, Code* code);
+    Traitement(string_view nom, Code* code);
 
 
    /**
@@ -46,28 +53,39 @@ public:
 
     /**
  * \brief    Indique le nom du traitement.
- * \return   Une chaine de caractères correspondant au nom du traitement
+ * \return   Une vue sur le nom du traitement, stocké une seule fois dans la table des identifiants du code
+ *           (voir Code::getTableIdentifiants()).
  */
-    String getNom ();
+    string_view getNom ();
+
+    /**
+ * \brief    Indique le numéro du nom du traitement dans la table des identifiants du code.
+ * \return   Le numéro du nom du traitement.
+ */
+    IdIdentifiant getIdNom ();
 
 
     /**
  * \brief      Définit le nom du traitement.
- * \param[in]  nom  le nom du traitement sous forme de chaîne de caractères. \n
+ * \details    Le nom est interné dans la table des identifiants du code (voir Code::getTableIdentifiants()).
+ * \param[in]  nom  Une vue sur le nom du traitement. \n
  */
-    void setNom (string nom);
+    void setNom (string_view nom);
 
 
 
    /**
  * \brief    Indique la ou les informations nécessaires à l'exécution du traitement.
  * \return   Un ensemble d'objets Information qui jouent le rôle de donnée pour le traitement.
- *           Si aucune information ne joue le rôle de donnée pour ce traitement, la valeur \c null est retournée.
+ *           Si aucune information ne joue le rôle de donnée pour ce traitement, la valeur \c null est retournée. \n
+ *           Ces informations sont lues dans le graphe des flux de données du code (voir GrapheFluxDeDonnees::getDonnees()).
  */
     Information* getDonnees ();
 
     /**
  * \brief    Ajoute une information à la liste des informations nécessaires pour exécuter le traitement.
+ * \details  Le lien est enregistré dans le graphe des flux de données du code : il n'est donc pas 
+ *           nécessaire d'appeler également informationIn->addTraitementEnDonnee(this).
  * \param[in]  informationIn  L'information à ajouter à a liste des informations qui jouent le rôle de donnée pour le traitement. \n
  */
     void addDonnee (Information* informationIn);
@@ -82,12 +100,15 @@ public:
     /**
  * \brief    Indique la ou les informations qui sont nécessaires pour l'exécution du traitement.
  * \return   Un ensemble d'objets Information désignant les informations qui joue le rôle de donnée pour le traitement.
- *           Si aucune information n'est en donnée du traitement, la valeur \c null est retournée.
+ *           Si aucune information n'est en donnée du traitement, la valeur \c null est retournée. \n
+ *           Ces informations sont lues dans le graphe des flux de données du code (voir GrapheFluxDeDonnees::getResultats()).
  */
     Information* getResultats ();
 
     /**
  * \brief    Ajoute une information à la liste des informations qui sont produites par le traitement.
+ * \details  Le lien est enregistré dans le graphe des flux de données du code : il n'est donc pas 
+ *           nécessaire d'appeler également informationOut->addTraitementEnResultat(this).
  * \param[in]  informationOut  L'information à ajouter à la liste des informations qui jouent le rôle de résultat pour le traitement. \n
  */
     void addResultat (Information* informationOut);
@@ -121,6 +142,8 @@ public:
 
     /**
  * \brief    Indique si le traitement est composé ou pas.
+ * \details  Les traitements composés sont repérés lors de la construction de l'arbre des traitements 
+ *           du code (voir Code::getArbreTraitements()).
  * \return   \c true si le traitement est un traitement composé, \c false si le traitement est un traitement simple.
  */
     bool estCompose ();
@@ -163,6 +186,56 @@ public:
  */
     bool estUnCalcul ();
 
+
+    /**
+ * \brief    Indique le numéro du traitement au sein du code.
+ * \details  Le numéro est attribué à la construction du traitement (compteur de traitements du code) et
+ *           ne change plus : les liens donnée / résultat peuvent donc être enregistrés avant que le code soit figé.
+ *           Le numéro d'un traitement supprimé n'est pas réattribué.
+ * \return   Un entier compris entre 0 et le nombre de traitements créés dans le code - 1, 
+ *           utilisé pour désigner le traitement dans le graphe des flux de données du code.
+ */
+    unsigned int getNumero ();
+
+
+    /**
+ * \brief    Indique si le corps du traitement a été décomposé.
+ * \details  Le corps d'un traitement n'est pas décomposé à la construction d'un code chargé en mode
+ *           CHARGEMENT_PARESSEUX (voir Code::Code()). Seules ses limites (voir getEtendue()) sont alors connues.
+ * \return   \c true si le corps du traitement a été décomposé, \c false sinon.
+ */
+    bool estDecompose ();
+
+    /**
+ * \brief    Décompose le corps du traitement s'il ne l'a pas encore été.
+ * \details  Le texte compris dans l'étendue du traitement est analysé : ses structures de contrôle, nombres 
+ *           magiques et liens donnée / résultat sont ajoutés au code. Cette méthode est appelée automatiquement
+ *           lors du premier accès à l'un de ces éléments (getDonnees(), getResultats(), getSousTraitements()...) ; 
+ *           les appels suivants sont sans effet. \n
+ *           Si le code était figé, il est d'abord défigé (voir Code::defiger()) et n'est pas figé à nouveau : 
+ *           les représentations CSR des graphes et l'arbre des structures ne sont reconstruits qu'une fois,
+ *           lors du premier accès suivant à l'un d'eux (voir Code::estRefigeageEnAttente()). Décomposer tous 
+ *           les traitements l'un après l'autre ne coûte donc qu'une seule reconstruction.
+ */
+    void decomposer ();
+    /**
+ * \brief    Indique la portion du fichier source à partir de laquelle le traitement a été construit.
+ * \return   Un objet EtendueSource délimitant le texte du traitement dans le fichier source.
+ */
+    EtendueSource getEtendue ();
+
+
+    /**
+ * \brief    Indique le contrat "données >> action >> résultats" écrit en commentaire au-dessus du traitement.
+ * \details  Lors du chargement du code, les données et résultats déclarés par le contrat sont ajoutés au 
+ *           graphe des flux de données du code (voir addDonnee() et addResultat()) ; leurs noms sont reliés 
+ *           aux informations visibles depuis le contrat (voir Code::getInformationParNom()). En mode 
+ *           CHARGEMENT_PARESSEUX, cet ajout n'a lieu que lors de la décomposition du traitement (voir decomposer()).
+ * \return   Un objet ContratTraitement, ou la valeur \c null si le traitement n'est précédé d'aucun contrat.
+ */
+    ContratTraitement* getContrat ();
+
+
 protected:
 
     /**
@@ -172,8 +245,8 @@ protected:
     Code* code;
 
     /**
- *   \var string nom
- *   \brief Le nom du traitement.  
+ *   \var IdIdentifiant nom
+ *   \brief Le numéro, dans la table des identifiants du code, du nom du traitement.  
  *   \details Le nom du traitement peut prendre plusieurs formes. Il peut s'agir du nom d'une fonction
  *            d'une procédure ou d'une méthode mais le traitement d'un traitement peut également prendre 
  *            la forme d'un commentaire. \n
@@ -181,34 +254,46 @@ protected:
  *            calculerRayon() <-- cas où le traitement est par exemple une fonction
  *            // Calculer le rayon  <-- cas où le traitement est nommé via un commentaire 
  */
-    string nom;
+    IdIdentifiant nom;
 
 
     /**
- *   \var Information* donnees
- *   \brief La liste des informations jouant le rôle de donnée pour le traitement.  
- *   \details Cet attribut représente la liste des informations jouant le rôle de donnée pour le traitement. \n
- *             Une information joue le rôle de donnée pour un traitement si sa valeur est nécessaire pour 
- *            pouvoir exécuter le traitement. 
+ *   \var unsigned int numero
+ *   \brief Le numéro du traitement au sein du code.  
+ *   \details Les informations jouant le rôle de donnée ou de résultat pour le traitement ne sont pas
+ *            mémorisées par le traitement : elles sont retrouvées, à partir de ce numéro, dans le graphe 
+ *            des flux de données du code (voir Code::getGrapheFluxDeDonnees()). \n
+ *            Une information joue le rôle de donnée pour un traitement si sa valeur est nécessaire pour 
+ *            pouvoir exécuter le traitement. \n
+ *            Une information est un résultat pour un traitement si sa valeur est calculée ou modifiée par le traitement.
  */
-    Information* donnees;
+    unsigned int numero;
 
 
     /**
- *   \var Information* resultats
- *   \brief La liste des informations produites par le traitement.  
- *   \details Cet attribut représente la liste des informations jouant le rôle de résultat pour le traitement. \n
- *             Une information est un résultat pour un traitement si sa valeur est calculée ou modifiée par le traitement.
+ *   \var IndexNoeud sontApres
+ *   \brief La liste (stockée dans l'arène du code) des traitements qui s'exécutent après le traitement.  
+ *   \details Cet attribut représente la liste des traitements exécutés après le traitement.
  */
-    Information* resultats;
+    IndexNoeud sontApres;
 
+    /**
+ *   \var EtendueSource etendue
+ *   \brief La portion du fichier source à partir de laquelle le traitement a été construit.
+ */
+    EtendueSource etendue;
 
     /**
- *   \var Traitement* sontApres
- *   \brief La liste des traitements qui s'exécutent après le traitement.  
- *   \details Cet attribut représente la liste des traitements exécutés après le traitement.
+ *   \var bool decompose
+ *   \brief Indique si le corps du traitement a été décomposé.
+ */
+    bool decompose;
+
+    /**
+ *   \var IndexNoeud contrat
+ *   \brief Le contrat (stocké dans l'arène du code) écrit au-dessus du traitement, ou INDEX_NUL.
  */
-    Traitement* sontApres;
+    IndexNoeud contrat;
 
 };
 #endif
\ No newline at end of file
@@ -12,67 +12,90 @@
 #define TYPE_H
 
 #include "Information.h"
+#include "TableIdentifiants.h"
 
 
 /** 
  *  \class Type
  *  \brief Une classe pour représenter le type (entier, caractère...) d'une information. 
+ *  \details Chaque type distinct n'existe qu'en un seul exemplaire au sein d'un code (ou d'un projet) : 
+ *           les objets Type ne sont pas construits directement mais obtenus auprès d'une TableTypes 
+ *           (voir Code::getTableTypes()). Deux informations de même type désignent donc le même objet Type,
+ *           et comparer deux types revient à comparer deux adresses.
  */
 class Type
 {
 public:
-/**
- * \brief    Constructeur : construit un objet type.
- * \param[in] nom  Le nom du type. \n
- *           Par exemple : int
+    /**
+ * \brief    Indique le nom du type du commentaire.
+ * \return   Une vue sur le nom du type, stocké une seule fois dans la table des identifiants du code (ou du projet).
+ *           Le nom est mis sous forme canonique (espaces superflus supprimés) : par exemple "int[]" ou "vector<int>".
  */
-    Type (string nom);
+    string_view getNomType ();
 
 
     /**
- * \brief    Indique le nom du type du commentaire.
- * \return   Une chaine de caractères correspondant au nom du type.
+ * \brief    Indique le type des éléments d'un type tableau ou le premier paramètre d'un type générique.
+ * \return   Un objet Type (\c int pour \c int[] ou \c vector<int>), ou la valeur \c null pour un type simple.
+ */
+    Type* getTypeElement ();
+
+
+    /**
+ * \brief    Indique le numéro du type au sein de la table des types qui l'a créé.
+ * \return   Un entier compris entre 0 et le nombre de types de la table - 1.
  */
-    string getNomType ();
+    unsigned int getNumero ();
 
 
     /**
- * \brief      Définit le nom d'un type de variable.
- * \param[in]  nom  une chaîne de caractères représentant le contenu du commentaire.
+ * \brief    Indique le nombre d'informations d'un code qui sont de ce type.
+ * \param[in]  code  Le code dont les informations sont comptées.
+ * \return   Un entier positif ou nul.
  */
-    void setNomType (string nom);
+    unsigned int getNbreInformations (Code* code);
 
    /**
- * \brief    Indique la ou les informations qui sont de ce type.
+ * \brief    Indique la ou les informations d'un code qui sont de ce type.
+ * \details  Un Type pouvant être partagé par tous les codes d'un projet, il ne mémorise pas ses informations :
+ *           elles sont lues dans l'index inverse tenu par le code lui-même (voir Code::getInformations(Type*)),
+ *           qui est détruit avec le code.
+ * \param[in]  code  Le code dont les informations sont recherchées.
  * \return   Un ensemble d'objets Information qui possèdent ce type.
  *           Si aucune information ne possède ce type, la valeur \c null est retournée.
  */
-    Information* getInformations ();
+    Information* getInformations (Code* code);
 
-    /**
- * \brief    Ajoute une information à la liste des informations ayant ce type.
- * \param[in]  information  L'information à ajouter à a liste des informations possédant ce type.
+private:
+/**
+ * \brief    Constructeur : construit un objet type.
+ * \details  Seule une TableTypes peut construire un objet Type (voir TableTypes::getType()).
+ * \param[in] nom  Le nom du type. \n
+ *           Par exemple : int
+ * \param[in] typeElement  Le type des éléments pour un type tableau ou générique, \c null sinon.
+ * \param[in] numero  Le numéro du type au sein de la table des types.
  */
-    void addInformation (Information* information);
+    Type (IdIdentifiant nom, Type* typeElement, unsigned int numero);
 
-    /**
- * \brief    Supprime l'information de la liste des informations ayant ce type.
- * \param[in]  information  L'information à supprimer de la liste des informations possédant ce type.
- */
-    void removeInformation (Information* information);
+    friend class TableTypes;
 
-private:
     /**
-    \var string nom
-    \brief le nom du type
+    \var IdIdentifiant nom
+    \brief le numéro, dans la table des identifiants du code (ou du projet), du nom du type
            Exemple : "int"
 */
-    string nom;
+    IdIdentifiant nom;
+
+    /**
+    \var Type* typeElement
+    \brief le type des éléments d'un type tableau ou générique, \c null pour un type simple
+*/
+    Type* typeElement;
 
     /**
-    \var Information* informations
-    \brief la liste des informations qui sont de ce type
+    \var unsigned int numero
+    \brief le numéro du type au sein de la table des types
 */
-    Information* informations;
+    unsigned int numero;
 };
 #endif
\ No newline at end of file
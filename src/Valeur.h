@@ -0,0 +1,203 @@
+/**
+ * \file      Valeur.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe Valeur.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe Valeur permettant de représenter
+ *             la valeur d'un littéral (entier, réel, booléen, caractère ou chaîne) écrit dans un code.
+ */
+
+#ifndef VALEUR_H
+#define VALEUR_H
+
+#include "TableIdentifiants.h"
+
+/**
+ *  \enum NatureValeur
+ *  \brief La nature de la valeur contenue dans un objet Valeur.
+ */
+enum NatureValeur
+{
+    VALEUR_AUCUNE,         /**< aucune valeur (par exemple, une variable non initialisée) */
+    VALEUR_ENTIER,         /**< un entier signé sur 64 bits */
+    VALEUR_REEL,           /**< un réel en double précision */
+    VALEUR_BOOLEEN,        /**< un booléen */
+    VALEUR_CARACTERE,      /**< un caractère */
+    VALEUR_CHAINE_COURTE,  /**< une chaîne d'au plus TAILLE_CHAINE_COURTE caractères, stockée dans l'objet lui-même */
+    VALEUR_LITTERAL        /**< une chaîne plus longue, stockée une seule fois dans une TableIdentifiants */
+};
+
+/**
+ * \brief    Nombre maximal de caractères d'une chaîne stockée directement dans un objet Valeur.
+ */
+const unsigned short int TAILLE_CHAINE_COURTE = 15;
+
+
+/**
+ *  \class Valeur
+ *  \brief Une classe pour représenter, sans allocation dynamique, la valeur d'un littéral.
+ *  \details Une Valeur est constituée d'une étiquette (voir NatureValeur) et d'une union contenant la valeur
+ *           elle-même. Elle est stockée directement dans l'objet qui la possède (Constante, NombreMagique,
+ *           VariableSimple...) : la lecture d'un littéral ne donne lieu à aucune allocation. \n
+ *           Les chaînes courtes sont recopiées dans l'objet ; les chaînes plus longues sont internées dans 
+ *           la table des identifiants du code (voir TableIdentifiants) et désignées par leur IdIdentifiant. \n
+ *           Deux valeurs sont égales si elles ont la même nature et le même contenu : la comparaison et le 
+ *           calcul de l'empreinte (voir getEmpreinte()) ne portent que sur l'objet lui-même. Deux chaînes
+ *           longues ne peuvent donc être comparées que si elles ont été internées dans la même table. \n
+ *           Les réels sont comparés après normalisation, et non selon les règles de l'arithmétique flottante : 
+ *           \c -0.0 est normalisé en \c 0.0 , et toutes les valeurs NaN sont normalisées en une même valeur NaN. 
+ *           Deux réels sont alors égaux si leurs représentations binaires normalisées sont identiques ; 
+ *           ainsi \c 0.0 est égal à \c -0.0 et un NaN est égal à lui-même, ce qui permet de regrouper 
+ *           les nombres magiques par valeur. L'empreinte est calculée sur cette même représentation normalisée.
+ */
+class Valeur
+{
+public:
+/**
+ * \brief    Constructeur : construit une valeur de nature VALEUR_AUCUNE.
+ */
+    Valeur ();
+
+/**
+ * \brief    Constructeur : construit une valeur entière.
+ * \details  Cette surcharge évite que l'écriture d'un littéral entier ( \c Valeur(20) ) soit ambiguë
+ *           entre les constructeurs à partir d'un \c long \c long \c int , d'un \c double , 
+ *           d'un \c bool et d'un \c char .
+ * \param[in] entier  La valeur de l'entier.
+ */
+    Valeur (int entier);
+
+/**
+ * \brief    Constructeur : construit une valeur entière.
+ * \param[in] entier  La valeur de l'entier.
+ */
+    Valeur (long long int entier);
+
+/**
+ * \brief    Constructeur : construit une valeur réelle.
+ * \param[in] reel  La valeur du réel.
+ */
+    Valeur (double reel);
+
+/**
+ * \brief    Constructeur : construit une valeur booléenne.
+ * \param[in] booleen  La valeur du booléen.
+ */
+    Valeur (bool booleen);
+
+/**
+ * \brief    Constructeur : construit une valeur de type caractère.
+ * \param[in] caractere  La valeur du caractère.
+ */
+    Valeur (char caractere);
+
+/**
+ * \brief    Constructeur : construit une valeur de type chaîne.
+ * \param[in] chaine  Les caractères de la chaîne, sans les guillemets.
+ * \param[in] table  La table dans laquelle interner la chaîne si elle compte plus de TAILLE_CHAINE_COURTE caractères.
+ */
+    Valeur (string_view chaine, TableIdentifiants* table);
+
+
+    /**
+ * \brief    Indique la nature de la valeur.
+ * \return   Une valeur de l'énumération NatureValeur.
+ */
+    NatureValeur getNature ();
+
+    /**
+ * \brief    Indique si l'objet contient une valeur.
+ * \return   \c false si la valeur est de nature VALEUR_AUCUNE, \c true sinon.
+ */
+    bool estDefinie ();
+
+    /**
+ * \brief    Indique si la valeur est numérique.
+ * \return   \c true si la valeur est de nature VALEUR_ENTIER ou VALEUR_REEL, \c false sinon.
+ */
+    bool estNumerique ();
+
+
+    /**
+ * \brief    Donne la valeur d'un entier (nature VALEUR_ENTIER uniquement).
+ * \return   La valeur de l'entier.
+ */
+    long long int getEntier ();
+
+    /**
+ * \brief    Donne la valeur d'un réel (nature VALEUR_REEL, ou VALEUR_ENTIER convertie en réel).
+ * \return   La valeur du réel.
+ */
+    double getReel ();
+
+    /**
+ * \brief    Donne la valeur d'un booléen (nature VALEUR_BOOLEEN uniquement).
+ * \return   La valeur du booléen.
+ */
+    bool getBooleen ();
+
+    /**
+ * \brief    Donne la valeur d'un caractère (nature VALEUR_CARACTERE uniquement).
+ * \return   La valeur du caractère.
+ */
+    char getCaractere ();
+
+    /**
+ * \brief    Donne les caractères d'une chaîne (nature VALEUR_CHAINE_COURTE ou VALEUR_LITTERAL).
+ * \param[in]  table  La table dans laquelle la chaîne a été internée (utilisée pour la nature VALEUR_LITTERAL).
+ * \return   Une vue sur les caractères de la chaîne.
+ */
+    string_view getChaine (TableIdentifiants* table);
+
+
+    /**
+ * \brief    Compare deux valeurs.
+ * \param[in]  autre  La valeur à comparer.
+ * \return   \c true si les deux valeurs ont la même nature et le même contenu (normalisé pour un réel), 
+ *           \c false sinon.
+ */
+    bool operator== (Valeur autre);
+
+    /**
+ * \brief    Compare deux valeurs.
+ * \param[in]  autre  La valeur à comparer.
+ * \return   La négation de operator==().
+ */
+    bool operator!= (Valeur autre);
+
+    /**
+ * \brief    Calcule l'empreinte de la valeur, afin de la ranger dans une table de hachage.
+ * \details  Deux valeurs égales ont toujours la même empreinte.
+ * \return   Un entier calculé à partir de la nature et du contenu (normalisé pour un réel) de la valeur.
+ */
+    unsigned long int getEmpreinte ();
+
+
+private:
+    /**
+    \var NatureValeur nature
+    \brief la nature de la valeur contenue dans l'objet.
+*/
+    NatureValeur nature;
+
+    /**
+    \var unsigned char longueur
+    \brief le nombre de caractères d'une chaîne de nature VALEUR_CHAINE_COURTE.
+*/
+    unsigned char longueur;
+
+    /**
+    \var union contenu
+    \brief la valeur elle-même, interprétée selon sa nature.
+*/
+    union
+    {
+        long long int entier;
+        double reel;
+        bool booleen;
+        char caractere;
+        char chaineCourte[TAILLE_CHAINE_COURTE];
+        IdIdentifiant litteral;
+    } contenu;
+};
+#endif
@@ -12,6 +12,7 @@
 #define VARIABLE_SIMPLE_H
 
 #include "Variable.h"
+#include "Valeur.h"
 
 /** 
  *  \class VariableSimple
@@ -26,7 +27,7 @@ public:
  * \param[in] estInitialisee indique si la variable est initialisée, à la déclaration ou bien après la déclaration. 
  * \param[in] valDepart indique quelle est la valeur initiale de la variable si une telle valeur est définie. 
  */
-    VariableSimple (bool estInitialisee = false, void* valDepart = null);
+    VariableSimple (bool estInitialisee = false, Valeur valDepart = Valeur());
 
 
     /**
@@ -45,16 +46,16 @@ public:
 
     /**
  * \brief    Indique la valeur initiale de la variable si celle-ci a été initialisée.
- * \return   La valeur initiale de la variable si celle-ci a été initialisée, \c null sinon.
+ * \return   La valeur initiale de la variable si celle-ci a été initialisée, une valeur de nature VALEUR_AUCUNE sinon.
  */
-    void* getValeurDepart ();
+    Valeur getValeurDepart ();
 
 
     /**
  * \brief      Définit la valeur de départ de la variable si celle-ci est initialisée.
  * \param[in]  valDepart  La valeur initiale de la variable si celle-ci est initialisée.
  */
-    void setValeurDepart (void* valDepart);
+    void setValeurDepart (Valeur valDepart);
 
 
 private:
@@ -65,9 +66,9 @@ private:
     bool estInitialisee;
 
     /**
-    \var void* valeurDepart
+    \var Valeur valeurDepart
     \brief la valeur de départ de la variable si celle-ci a été initialisée.
 */
-    void* valeurDepart;
+    Valeur valeurDepart;
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,119 @@
+/**
+ * \file      VerificateurContrats.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les attributs et méthodes d'une classe VerificateurContrats.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe VerificateurContrats permettant de repérer
+ *             les contrats de traitement qui ne correspondent pas à ce que fait réellement le code.
+ */
+
+#ifndef VERIFICATEUR_CONTRATS_H
+#define VERIFICATEUR_CONTRATS_H
+
+#include "Code.h"
+#include "ContratTraitement.h"
+
+/**
+ *  \enum NatureDivergence
+ *  \brief Les façons dont un contrat peut diverger du flux de données réel d'un traitement.
+ */
+enum NatureDivergence
+{
+    NOM_INCONNU,            /**< le contrat désigne une information qui n'est pas déclarée dans le code */
+    DONNEE_NON_DECLAREE,    /**< le traitement lit une information absente de ses données */
+    DONNEE_NON_UTILISEE,    /**< une donnée du contrat n'est jamais lue par le traitement */
+    RESULTAT_NON_DECLARE,   /**< le traitement modifie une information absente de ses résultats */
+    RESULTAT_NON_PRODUIT,   /**< un résultat du contrat n'est jamais modifié par le traitement */
+    ELEMENT_EN_DOUBLE       /**< un nom est cité plusieurs fois dans la même liste du contrat (voir ContratTraitement::getDoublons()) */
+};
+
+
+/**
+ *  \struct DivergenceContrat
+ *  \brief Un enregistrement décrivant une divergence entre le contrat d'un traitement et son flux de données réel.
+ */
+struct DivergenceContrat
+{
+    /**
+    \var Traitement* traitement
+    \brief le traitement dont le contrat diverge.
+*/
+    Traitement* traitement;
+
+    /**
+    \var NatureDivergence nature
+    \brief la nature de la divergence.
+*/
+    NatureDivergence nature;
+
+    /**
+    \var IdIdentifiant nom
+    \brief le numéro, dans la table des identifiants du code, du nom de l'information concernée.
+*/
+    IdIdentifiant nom;
+};
+
+
+/**
+ *  \class VerificateurContrats
+ *  \brief Une classe pour comparer le contrat de chaque traitement d'un code à son flux de données réel.
+ *  \details Le flux de données déclaré est celui du graphe des flux de données du code, alimenté par les 
+ *           contrats (voir Code::getGrapheFluxDeDonnees()). Le flux de données réel est celui du graphe des 
+ *           accès relevés lors de la décomposition du corps des traitements (voir Code::getGrapheAcces()). \n
+ *           Les deux graphes étant figés, les informations de chaque traitement forment des tranches triées 
+ *           par numéro croissant et sans doublon (voir AdjacenceCSR) : elles sont comparées par fusion, en temps linéaire en le nombre d'arcs. \n
+ *           Les crochets (ELEMENT_MODIFIE) ont une signification différente selon le côté du contrat :
+ *           - parmi les données, <tt>[moyenne]</tt> désigne une information lue dont la valeur n'est disponible 
+ *             que dans certains cas : elle est attendue parmi les lectures, et n'est pas attendue parmi les écritures
+ *             (<tt>nombreDeNotes, [moyenne] >> Afficher le résultat >> (ecran)</tt> ne fait que lire \c moyenne ) ;
+ *           - parmi les résultats, <tt>[moyenne]</tt> désigne une information produite, éventuellement dans 
+ *             certains cas seulement, ou mise à jour à partir de sa valeur précédente : elle est attendue parmi les 
+ *             écritures, et sa lecture éventuelle n'est pas signalée comme DONNEE_NON_DECLAREE 
+ *             (<tt>... >> CALCULER LA MOYENNE SI POSSIBLE >> [moyenne]</tt> ne fait qu'écrire \c moyenne , 
+ *             <tt>... >> [sommeNotes], [nombreDeNotes]</tt> les lit et les écrit).
+ *
+ *           Un ELEMENT_PERIPHERIQUE n'est pas vérifié. Chaque nom répété dans une liste du contrat donne lieu 
+ *           à une divergence ELEMENT_EN_DOUBLE. \n
+ *           Les noms du contrat sont reliés aux informations visibles depuis le traitement (voir 
+ *           Code::getInformationParNom()). Le graphe des accès n'étant alimenté que par la décomposition du 
+ *           corps des traitements, le code est d'abord entièrement décomposé (voir Code::materialiser()) 
+ *           s'il a été chargé en mode CHARGEMENT_PARESSEUX : aucun traitement n'est donc vérifié sur un 
+ *           graphe des accès incomplet.
+ */
+class VerificateurContrats
+{
+public:
+/**
+ * \brief    Constructeur : vérifie les contrats des traitements d'un code.
+ * \param[in] code  Le code (figé) dont les contrats doivent être vérifiés ; il est matérialisé si besoin.
+ */
+    VerificateurContrats (Code* code);
+
+
+    /**
+ * \brief    Indique le nombre de divergences trouvées.
+ * \return   Un entier positif ou nul.
+ */
+    unsigned int getNbreDivergences ();
+
+    /**
+ * \brief    Donne accès aux divergences trouvées.
+ * \return   Un tableau de getNbreDivergences() enregistrements, rangés selon le numéro des traitements.
+ */
+    DivergenceContrat* getDivergences ();
+
+
+private:
+    /**
+    \var unsigned int nbreDivergences
+    \brief le nombre de divergences trouvées.
+*/
+    unsigned int nbreDivergences;
+
+    /**
+    \var DivergenceContrat* divergences
+    \brief les divergences trouvées.
+*/
+    DivergenceContrat* divergences;
+};
+#endif
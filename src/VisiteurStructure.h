@@ -0,0 +1,78 @@
+/**
+ * \file      VisiteurStructure.h
+ * \date      17 octobre 2026
+ * \brief     Spécifie les méthodes d'une classe VisiteurStructure.
+ *
+ * \details    Ce fichier décrit les caractéristiques d'une classe VisiteurStructure permettant de parcourir
+ *             des structures de contrôle en traitant chaque nature de structure de manière spécifique.
+ */
+
+#ifndef VISITEUR_STRUCTURE_H
+#define VISITEUR_STRUCTURE_H
+
+#include "StructureDeControle.h"
+#include "StructureSi.h"
+#include "StructureSiSinon.h"
+#include "StructureSiSi.h"
+#include "StructureImbriquee.h"
+#include "IterationAvecNombreDeRepetitionsConnu.h"
+#include "IterationAvecNombreDeRepetitionsInconnu.h"
+
+/**
+ *  \class VisiteurStructure
+ *  \brief Une classe abstraite pour traiter des structures de contrôle selon leur nature.
+ *  \details Une analyse portant sur les structures de contrôle hérite de cette classe et redéfinit les 
+ *           méthodes correspondant aux natures de structures qui l'intéressent, puis appelle 
+ *           StructureDeControle::accepter() sur chaque structure à analyser. \n
+ *           Les méthodes non redéfinies appellent visiterAutre().
+ */
+class VisiteurStructure
+{
+public:
+    virtual ~VisiteurStructure() = 0;
+
+    /**
+ * \brief    Traite une structure conditionnelle de type StructureSi.
+ * \param[in]  structure  La structure à traiter.
+ */
+    virtual void visiterStructureSi (StructureSi* structure);
+
+    /**
+ * \brief    Traite une structure conditionnelle de type StructureSiSinon.
+ * \param[in]  structure  La structure à traiter.
+ */
+    virtual void visiterStructureSiSinon (StructureSiSinon* structure);
+
+    /**
+ * \brief    Traite une structure conditionnelle de type StructureSiSi.
+ * \param[in]  structure  La structure à traiter.
+ */
+    virtual void visiterStructureSiSi (StructureSiSi* structure);
+
+    /**
+ * \brief    Traite une itération avec nombre de répétitions connu.
+ * \param[in]  structure  La structure à traiter.
+ */
+    virtual void visiterIterationAvecNombreDeRepetitionsConnu (IterationAvecNombreDeRepetitionsConnu* structure);
+
+    /**
+ * \brief    Traite une itération avec nombre de répétitions inconnu, quel que soit le moment où sont évaluées ses conditions.
+ * \param[in]  structure  La structure à traiter.
+ */
+    virtual void visiterIterationAvecNombreDeRepetitionsInconnu (IterationAvecNombreDeRepetitionsInconnu* structure);
+
+    /**
+ * \brief    Traite une structure imbriquée.
+ * \details  Par défaut, les structures imbriquées dans la structure sont transmises une à une au visiteur.
+ * \param[in]  structure  La structure à traiter.
+ */
+    virtual void visiterStructureImbriquee (StructureImbriquee* structure);
+
+    /**
+ * \brief    Traite une structure de contrôle d'une nature pour laquelle aucune méthode spécifique n'a été redéfinie.
+ * \details  Par défaut, cette méthode ne fait rien.
+ * \param[in]  structure  La structure à traiter. Sa nature est donnée par StructureDeControle::getNature().
+ */
+    virtual void visiterAutre (StructureDeControle* structure);
+};
+#endif